@@ -1,3 +1,14 @@
 # ==== Test config ====
 option(PYRO_COMMON_BUILD_TESTS "Build tests" OFF) 
 option(PYRO_COMMON_SHARED_LIBRARY "Build Common as shared library" OFF) 
+option(PYRO_COMMON_BUILD_BENCHMARKS "Build benchmarks" OFF)
+option(PYRO_COMMON_BUILD_TOOLS "Build tools, e.g. the binary log decoder and flight recorder dump" OFF)
+
+# ==== Memory config ====
+option(PYRO_COMMON_USE_SNMALLOC "Route the EASTL allocation hooks through snmalloc" OFF)
+option(PYRO_COMMON_USE_SLAB_ALLOCATOR "Route the EASTL allocation hooks through the SlabAllocator" OFF)
+option(PYRO_COMMON_TRACK_ALLOCATIONS "Tag and account every EASTL allocation in the AllocationTracker" OFF)
+
+# ==== Logging config ====
+set(PYRO_COMMON_MIN_LOG_SEVERITY "Auto" CACHE STRING "Log calls below this severity are compiled out. Auto keeps everything in Debug builds and strips below Info otherwise")
+set_property(CACHE PYRO_COMMON_MIN_LOG_SEVERITY PROPERTY STRINGS Auto Verbose Debug Trace Info Warn Error Fatal)
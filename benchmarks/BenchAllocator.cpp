@@ -0,0 +1,157 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/SlabAllocator.hpp>
+
+#include <EASTL/allocator.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/list.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+
+#ifdef PYRO_COMMON_USE_SNMALLOC
+#include <snmalloc/snmalloc.h>
+#endif
+
+using namespace PyroshockStudios;
+
+// Container workloads run against these allocators:
+//  - MallocAllocator: the C runtime heap, called directly
+//  - SlabAllocator: the PyroCommon slab allocator, called directly
+//  - SnmallocAllocator: snmalloc, called directly (only with PYRO_COMMON_USE_SNMALLOC)
+//  - eastl::allocator: whatever the MemoryOverload.hpp hooks are configured to use
+
+namespace {
+    struct MallocAllocator {
+        explicit MallocAllocator(const char* = nullptr) {}
+        MallocAllocator(const MallocAllocator&, const char*) {}
+
+        void* allocate(usize n, int = 0) { return std::malloc(n); }
+        void* allocate(usize n, usize, usize, int = 0) { return std::malloc(n); }
+        void deallocate(void* p, usize) { std::free(p); }
+
+        const char* get_name() const { return "MallocAllocator"; }
+        void set_name(const char*) {}
+
+        bool operator==(const MallocAllocator&) const { return true; }
+        bool operator!=(const MallocAllocator&) const { return false; }
+    };
+
+#ifdef PYRO_COMMON_USE_SNMALLOC
+    struct SnmallocAllocator {
+        explicit SnmallocAllocator(const char* = nullptr) {}
+        SnmallocAllocator(const SnmallocAllocator&, const char*) {}
+
+        void* allocate(usize n, int = 0) { return snmalloc::libc::malloc(n); }
+        void* allocate(usize n, usize alignment, usize, int = 0) { return snmalloc::libc::aligned_alloc(alignment, n); }
+        void deallocate(void* p, usize) { snmalloc::libc::free(p); }
+
+        const char* get_name() const { return "SnmallocAllocator"; }
+        void set_name(const char*) {}
+
+        bool operator==(const SnmallocAllocator&) const { return true; }
+        bool operator!=(const SnmallocAllocator&) const { return false; }
+    };
+#endif
+
+    template <typename Allocator>
+    void BM_VectorGrowth(benchmark::State& state) {
+        const i64 count = state.range(0);
+        for (auto _ : state) {
+            eastl::vector<u32, Allocator> values;
+            for (i64 i = 0; i < count; ++i) {
+                values.push_back(static_cast<u32>(i));
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename Allocator>
+    void BM_StringChurn(benchmark::State& state) {
+        const i64 count = state.range(0);
+        for (auto _ : state) {
+            eastl::vector<eastl::basic_string<char, Allocator>, Allocator> strings;
+            strings.reserve(static_cast<usize>(count));
+            for (i64 i = 0; i < count; ++i) {
+                // long enough to defeat the small string optimisation
+                strings.emplace_back(static_cast<usize>(48 + (i & 63)), 'x');
+            }
+            benchmark::DoNotOptimize(strings.data());
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename Allocator>
+    void BM_ListNodes(benchmark::State& state) {
+        const i64 count = state.range(0);
+        for (auto _ : state) {
+            eastl::list<u64, Allocator> nodes;
+            for (i64 i = 0; i < count; ++i) {
+                nodes.push_back(static_cast<u64>(i));
+                if (i & 1) {
+                    nodes.pop_front();
+                }
+            }
+            benchmark::DoNotOptimize(nodes.size());
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <typename Allocator>
+    void BM_HashMapInsert(benchmark::State& state) {
+        const i64 count = state.range(0);
+        for (auto _ : state) {
+            eastl::hash_map<u32, u64, eastl::hash<u32>, eastl::equal_to<u32>, Allocator> map;
+            for (i64 i = 0; i < count; ++i) {
+                map[static_cast<u32>(i * 2654435761u)] = static_cast<u64>(i);
+            }
+            benchmark::DoNotOptimize(map.size());
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+} // namespace
+
+#define PYRO_ALLOCATOR_BENCHMARK(fn, alloc) BENCHMARK_TEMPLATE(fn, alloc)->Arg(64)->Arg(1024)->Arg(16384)
+
+PYRO_ALLOCATOR_BENCHMARK(BM_VectorGrowth, MallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_VectorGrowth, eastl::allocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_StringChurn, MallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_StringChurn, eastl::allocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_ListNodes, MallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_ListNodes, eastl::allocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_HashMapInsert, MallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_HashMapInsert, eastl::allocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_VectorGrowth, SlabAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_StringChurn, SlabAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_ListNodes, SlabAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_HashMapInsert, SlabAllocator);
+
+#ifdef PYRO_COMMON_USE_SNMALLOC
+PYRO_ALLOCATOR_BENCHMARK(BM_VectorGrowth, SnmallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_StringChurn, SnmallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_ListNodes, SnmallocAllocator);
+PYRO_ALLOCATOR_BENCHMARK(BM_HashMapInsert, SnmallocAllocator);
+#endif
@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/AsyncFileIO.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/vector.h>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+using namespace PyroshockStudios;
+
+// Reads state.range(0) scattered 4 KiB blocks of a 64 MiB file, one blocking call at a time
+// against all of them in flight at once
+namespace {
+    constexpr usize BLOCK_SIZE = 4096;
+    constexpr usize FILE_BLOCKS = 64 * 1024 * 1024 / BLOCK_SIZE;
+
+    eastl::string DataPath() {
+        const eastl::string path = (std::filesystem::temp_directory_path() / "pyro_bench_async.bin").string().c_str();
+        FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+        const eastl::vector<u8> chunk(1024 * 1024, 0x3C);
+        for (usize i = 0; i < FILE_BLOCKS * BLOCK_SIZE / chunk.size(); ++i) {
+            benchmark::DoNotOptimize(file.Write(chunk.data(), chunk.size()));
+        }
+        return path;
+    }
+
+    u64 BlockOffset(usize i) {
+        return static_cast<u64>((i * 2654435761u) % FILE_BLOCKS) * BLOCK_SIZE;
+    }
+
+    void BM_FileStreamScatteredReads(benchmark::State& state) {
+        FileStream file(DataPath(), FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+        eastl::vector<u8> out(static_cast<usize>(state.range(0)) * BLOCK_SIZE);
+        for (auto _ : state) {
+            for (usize i = 0; i < static_cast<usize>(state.range(0)); ++i) {
+                benchmark::DoNotOptimize(file.ReadAt(out.data() + i * BLOCK_SIZE, BLOCK_SIZE, BlockOffset(i)));
+            }
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * BLOCK_SIZE);
+    }
+
+    void ScatteredReadsAsync(benchmark::State& state, bool threadPool) {
+        FileStream file(DataPath(), FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+        AsyncFileIOConfig config;
+        config.forceThreadPool = threadPool;
+        AsyncFileIO io(config);
+        eastl::vector<u8> out(static_cast<usize>(state.range(0)) * BLOCK_SIZE);
+        const eastl::span<u8> buffers[] = { { out.data(), out.size() } };
+        benchmark::DoNotOptimize(io.RegisterBuffers(buffers));
+        for (auto _ : state) {
+            for (usize i = 0; i < static_cast<usize>(state.range(0)); ++i) {
+                benchmark::DoNotOptimize(io.ReadAsync(file, out.data() + i * BLOCK_SIZE, BLOCK_SIZE, BlockOffset(i)));
+            }
+            io.WaitAll();
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * BLOCK_SIZE);
+    }
+
+    void BM_AsyncFileIOScatteredReads(benchmark::State& state) {
+        ScatteredReadsAsync(state, false);
+    }
+
+    void BM_AsyncFileIOThreadPoolScatteredReads(benchmark::State& state) {
+        ScatteredReadsAsync(state, true);
+    }
+} // namespace
+
+BENCHMARK(BM_FileStreamScatteredReads)->Arg(256);
+BENCHMARK(BM_AsyncFileIOScatteredReads)->Arg(256);
+BENCHMARK(BM_AsyncFileIOThreadPoolScatteredReads)->Arg(256);
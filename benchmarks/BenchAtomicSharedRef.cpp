@@ -0,0 +1,72 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/AtomicSharedRef.hpp>
+
+#include <benchmark/benchmark.h>
+#include <mutex>
+
+using namespace PyroshockStudios;
+
+// Readers load a published object while thread 0 republishes it every 64 reads,
+// through AtomicSharedRef and through a mutex around a plain SharedRef
+namespace {
+    struct Published : public RefCounted {
+        u64 payload = 0;
+    };
+
+    void BM_PublishAtomicSharedRef(benchmark::State& state) {
+        static AtomicSharedRef<Published> slot(SharedRef<Published>::Create());
+        u64 reads = 0;
+        for (auto _ : state) {
+            if (state.thread_index() == 0 && (++reads & 63) == 0) {
+                slot.Store(SharedRef<Published>::Create());
+            }
+            SharedRef<Published> current = slot.Load();
+            benchmark::DoNotOptimize(current.Get());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_PublishMutexSharedRef(benchmark::State& state) {
+        static std::mutex mutex;
+        static SharedRef<Published> slot = SharedRef<Published>::Create();
+        u64 reads = 0;
+        for (auto _ : state) {
+            if (state.thread_index() == 0 && (++reads & 63) == 0) {
+                SharedRef<Published> next = SharedRef<Published>::Create();
+                std::lock_guard lock(mutex);
+                slot = eastl::move(next);
+            }
+            SharedRef<Published> current;
+            {
+                std::lock_guard lock(mutex);
+                current = slot;
+            }
+            benchmark::DoNotOptimize(current.Get());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK(BM_PublishAtomicSharedRef)->Threads(1)->Threads(4)->Threads(8);
+BENCHMARK(BM_PublishMutexSharedRef)->Threads(1)->Threads(4)->Threads(8);
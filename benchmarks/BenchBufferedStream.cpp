@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/BufferedReader.hpp>
+#include <PyroCommon/Stream/BufferedWriter.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+using namespace PyroshockStudios;
+
+// Writes and reads back state.range(0) 4 byte fields the way BinarySerializer does, one stream call per field
+namespace {
+    eastl::string BenchPath() {
+        return (std::filesystem::temp_directory_path() / "pyro_bench_buffered.bin").string().c_str();
+    }
+
+    void WriteFields(benchmark::State& state, IStreamWriter& writer) {
+        for (u32 i = 0; i < static_cast<u32>(state.range(0)); ++i) {
+            benchmark::DoNotOptimize(writer.Write(&i, sizeof(i)));
+        }
+    }
+
+    void ReadFields(benchmark::State& state, IStreamReader& reader) {
+        u32 value = 0;
+        for (i64 i = 0; i < state.range(0); ++i) {
+            benchmark::DoNotOptimize(reader.Read(&value, sizeof(value)));
+        }
+    }
+
+    void BM_FileStreamWriteFields(benchmark::State& state) {
+        for (auto _ : state) {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            WriteFields(state, file);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_BufferedWriteFields(benchmark::State& state) {
+        for (auto _ : state) {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            BufferedWriter writer(file);
+            WriteFields(state, writer);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_FileStreamReadFields(benchmark::State& state) {
+        {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            BufferedWriter writer(file);
+            WriteFields(state, writer);
+        }
+        for (auto _ : state) {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+            ReadFields(state, file);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_BufferedReadFields(benchmark::State& state) {
+        {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            BufferedWriter writer(file);
+            WriteFields(state, writer);
+        }
+        for (auto _ : state) {
+            FileStream file(BenchPath(), FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+            BufferedReader reader(file);
+            ReadFields(state, reader);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+} // namespace
+
+BENCHMARK(BM_FileStreamWriteFields)->Arg(64 * 1024);
+BENCHMARK(BM_BufferedWriteFields)->Arg(64 * 1024);
+BENCHMARK(BM_FileStreamReadFields)->Arg(64 * 1024);
+BENCHMARK(BM_BufferedReadFields)->Arg(64 * 1024);
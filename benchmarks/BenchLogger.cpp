@@ -0,0 +1,185 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/Logging/AsyncLogStream.hpp>
+#include <PyroCommon/Logging/FlightRecorderLogStream.hpp>
+#include <PyroCommon/Logging/PerThreadLogStream.hpp>
+#include <PyroCommon/Logging/RotatingFileLogStream.hpp>
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <stdio.h>
+
+using namespace PyroshockStudios;
+
+// Logger::Info straight into a sink that writes every line to /dev/null, through an AsyncLogStream in front of it,
+// and with the formatting deferred to the AsyncLogStream's sink thread.
+// The Filtered benchmarks log below the minimum severity, checked through the stream and through a LogChannel.
+// PerThread gives every thread its own ring, merged by timestamp on a collector thread.
+// FlightRecorder logs into a memory-mapped ring in the temp directory.
+// RotatingFile writes blocks of lines to segments in the temp directory from a writer thread.
+// The Storm benchmarks log from one call site in a loop, where all but a few messages are suppressed.
+namespace {
+    class DevNullLogStream : public ILogStream {
+    public:
+        explicit DevNullLogStream(LogSeverity minSeverity = LogSeverity::Verbose)
+            : mFile(fopen("/dev/null", "w")), mMinSeverity(minSeverity) {}
+        ~DevNullLogStream() {
+            if (mFile) {
+                fclose(mFile);
+            }
+        }
+
+        void Log(LogSeverity severity, const char* message) override {
+            if (mFile) {
+                fprintf(mFile, "[%u] %s\n", static_cast<u32>(severity), message);
+                fflush(mFile);
+            }
+        }
+        LogSeverity MinSeverity() const override { return mMinSeverity; }
+        const char* Name() const override { return "DevNull"; }
+
+    private:
+        FILE* mFile;
+        LogSeverity mMinSeverity;
+    };
+
+    void BM_LogDirect(benchmark::State& state) {
+        static DevNullLogStream sink;
+        u64 i = 0;
+        for (auto _ : state) {
+            Logger::Info(&sink, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogAsync(benchmark::State& state) {
+        static DevNullLogStream sink;
+        static ILogStream* sinks[] = { &sink };
+        static AsyncLogStream stream(sinks, 1 << 16, LogOverflowPolicy::Drop);
+        u64 i = 0;
+        for (auto _ : state) {
+            Logger::Info(&stream, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogDeferred(benchmark::State& state) {
+        static DevNullLogStream sink;
+        static ILogStream* sinks[] = { &sink };
+        static AsyncLogStream stream(sinks, 1 << 16, LogOverflowPolicy::Drop);
+        u64 i = 0;
+        for (auto _ : state) {
+            stream.LogDeferred(LogSeverity::Info, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogPerThread(benchmark::State& state) {
+        static DevNullLogStream sink;
+        static ILogStream* sinks[] = { &sink };
+        static PerThreadLogStream stream(sinks, 1 << 20, LogOverflowPolicy::Drop);
+        u64 i = 0;
+        for (auto _ : state) {
+            Logger::Info(&stream, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogFlightRecorder(benchmark::State& state) {
+        static FlightRecorderLogStream recorder((std::filesystem::temp_directory_path() / "pyro_bench_flight.bin").string().c_str());
+        u64 i = 0;
+        for (auto _ : state) {
+            Logger::Info(&recorder, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogRotatingFile(benchmark::State& state) {
+        static RotatingFileLogStream stream([] {
+            RotatingFileLogConfig config;
+            config.basePath = (std::filesystem::temp_directory_path() / "pyro_bench_rotating").string().c_str();
+            config.maxSegments = 2;
+            return config;
+        }());
+        u64 i = 0;
+        for (auto _ : state) {
+            Logger::Info(&stream, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogFilteredStream(benchmark::State& state) {
+        static DevNullLogStream sink(LogSeverity::Error);
+        ILogStream* stream = &sink;
+        benchmark::DoNotOptimize(stream);
+        u64 i = 0;
+        for (auto _ : state) {
+            PYRO_LOG(Verbose, stream, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogFilteredChannel(benchmark::State& state) {
+        static DevNullLogStream sink;
+        static LogChannel& channel = []() -> LogChannel& {
+            LogChannel& channel = LogChannelRegistry::Get("bench");
+            channel.SetStream(&sink);
+            channel.SetMinSeverity(LogSeverity::Error);
+            return channel;
+        }();
+        u64 i = 0;
+        for (auto _ : state) {
+            PYRO_LOG(Verbose, channel, "frame {} took {:.3f} ms", i++, 16.6);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogStormRepeated(benchmark::State& state) {
+        static DevNullLogStream sink;
+        for (auto _ : state) {
+            PYRO_LOG(Warn, &sink, "device lost while submitting frame {}", 1);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_LogStormDistinct(benchmark::State& state) {
+        static DevNullLogStream sink;
+        u64 i = 0;
+        for (auto _ : state) {
+            PYRO_LOG(Warn, &sink, "device lost while submitting frame {}", i++);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK(BM_LogDirect)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogAsync)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogDeferred)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogPerThread)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogFlightRecorder)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogRotatingFile)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogFilteredStream);
+BENCHMARK(BM_LogFilteredChannel);
+BENCHMARK(BM_LogStormRepeated)->Threads(1)->Threads(4);
+BENCHMARK(BM_LogStormDistinct)->Threads(1)->Threads(4);
@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/FileStream.hpp>
+#include <PyroCommon/Stream/MappedFileStream.hpp>
+
+#include <EASTL/vector.h>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+using namespace PyroshockStudios;
+
+// Loads a state.range(0) MiB asset and sums one byte per 4 KiB page, FileStream copies the
+// whole file into a user buffer first while MappedFileStream only touches the pages
+namespace {
+    eastl::string AssetPath(i64 mebibytes) {
+        const eastl::string path = (std::filesystem::temp_directory_path() / "pyro_bench_mapped.bin").string().c_str();
+        FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+        const eastl::vector<u8> chunk(1024 * 1024, 0x5A);
+        for (i64 i = 0; i < mebibytes; ++i) {
+            benchmark::DoNotOptimize(file.Write(chunk.data(), chunk.size()));
+        }
+        return path;
+    }
+
+    u64 SumPages(const u8* data, usize size) {
+        u64 sum = 0;
+        for (usize i = 0; i < size; i += 4096) {
+            sum += data[i];
+        }
+        return sum;
+    }
+
+    void BM_FileStreamLoadAsset(benchmark::State& state) {
+        const eastl::string path = AssetPath(state.range(0));
+        for (auto _ : state) {
+            FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+            eastl::vector<u8> bytes(file.Length());
+            benchmark::DoNotOptimize(file.Read(bytes.data(), bytes.size()));
+            benchmark::DoNotOptimize(SumPages(bytes.data(), bytes.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 1024 * 1024);
+    }
+
+    void BM_MappedFileStreamLoadAsset(benchmark::State& state) {
+        const eastl::string path = AssetPath(state.range(0));
+        for (auto _ : state) {
+            MappedFileStream file(path, MappedFileStream::Mode::ReadOnly);
+            benchmark::DoNotOptimize(file.Advise(MappedFileStream::AccessHint::Sequential));
+            const auto span = file.Span();
+            benchmark::DoNotOptimize(SumPages(span.data(), span.size()));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 1024 * 1024);
+    }
+} // namespace
+
+BENCHMARK(BM_FileStreamLoadAsset)->Arg(64);
+BENCHMARK(BM_MappedFileStreamLoadAsset)->Arg(64);
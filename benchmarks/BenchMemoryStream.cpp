@@ -0,0 +1,62 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/MemoryStream.hpp>
+#include <PyroCommon/VirtualBuffer.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace PyroshockStudios;
+
+// Serialises a snapshot of state.range(0) MiB in 4 KiB writes, the vector-backed stream
+// copies everything written so far whenever it regrows
+namespace {
+    constexpr usize SNAPSHOT_WRITE_SIZE = 4096;
+
+    void WriteSnapshot(benchmark::State& state, MemoryStream& stream) {
+        static const u8 payload[SNAPSHOT_WRITE_SIZE] = {};
+        const usize writes = static_cast<usize>(state.range(0)) * 1024 * 1024 / SNAPSHOT_WRITE_SIZE;
+        for (usize i = 0; i < writes; ++i) {
+            benchmark::DoNotOptimize(stream.Write(payload, sizeof(payload)));
+        }
+        benchmark::DoNotOptimize(stream.Span().data());
+    }
+
+    void BM_MemoryStreamVector(benchmark::State& state) {
+        for (auto _ : state) {
+            MemoryStream stream;
+            WriteSnapshot(state, stream);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 1024 * 1024);
+    }
+
+    void BM_MemoryStreamVirtualBuffer(benchmark::State& state) {
+        for (auto _ : state) {
+            MemoryStream stream(VirtualBuffer(static_cast<usize>(state.range(0)) * 1024 * 1024));
+            WriteSnapshot(state, stream);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0) * 1024 * 1024);
+    }
+} // namespace
+
+BENCHMARK(BM_MemoryStreamVector)->Arg(16)->Arg(256);
+BENCHMARK(BM_MemoryStreamVirtualBuffer)->Arg(16)->Arg(256);
@@ -0,0 +1,54 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Memory.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace PyroshockStudios;
+
+// Cost of copying and destroying a SharedRef under each reference counting policy,
+// on the thread that created the object and, for the atomic and biased policies, on another thread
+namespace {
+    template <RefCountPolicy Policy>
+    struct Handle : public BasicRefCounted<Policy> {
+        u64 payload = 0;
+    };
+
+    template <RefCountPolicy Policy>
+    void BM_SharedRefCopy(benchmark::State& state) {
+        // whichever thread gets here first owns the object
+        static SharedRef<Handle<Policy>> shared = SharedRef<Handle<Policy>>::Create();
+        SharedRef<Handle<Policy>> local = shared;
+        for (auto _ : state) {
+            SharedRef<Handle<Policy>> copy = local;
+            benchmark::DoNotOptimize(copy.Get());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_SharedRefCopy, RefCountPolicy::Atomic);
+BENCHMARK_TEMPLATE(BM_SharedRefCopy, RefCountPolicy::NonAtomic);
+BENCHMARK_TEMPLATE(BM_SharedRefCopy, RefCountPolicy::Biased);
+BENCHMARK_TEMPLATE(BM_SharedRefCopy, RefCountPolicy::Atomic)->Threads(4);
+BENCHMARK_TEMPLATE(BM_SharedRefCopy, RefCountPolicy::Biased)->Threads(4);
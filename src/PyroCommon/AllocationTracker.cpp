@@ -0,0 +1,295 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AllocationTracker.hpp"
+
+#include <PyroCommon/Logger.hpp>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/atomic.h>
+#include <bit>
+#include <mutex>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        constexpr usize TAG_CACHE_SIZE = 1024;
+
+        struct alignas(64) GlobalTagCounters {
+            eastl::atomic<i64> liveBytes = { 0 };
+            eastl::atomic<i64> peakBytes = { 0 };
+            eastl::atomic<u64> allocationCount = { 0 };
+            eastl::atomic<u64> deallocationCount = { 0 };
+        };
+
+        struct TagCacheEntry {
+            eastl::atomic<const char*> name = { nullptr };
+            eastl::atomic<u16> tag = { AllocationTracker::UNTAGGED };
+        };
+
+        struct TrackerState {
+            GlobalTagCounters counters[AllocationTracker::MAX_TAGS];
+            eastl::atomic<u64> histogram[AllocationTracker::HISTOGRAM_BUCKETS] = {};
+
+            // Registration is rare and goes through the mutex, lookups go through the pointer cache
+            std::mutex registryMutex;
+            char names[AllocationTracker::MAX_TAGS][AllocationTracker::MAX_TAG_NAME_LENGTH] = {};
+            eastl::atomic<u16> tagCount = { 1 };
+            TagCacheEntry cache[TAG_CACHE_SIZE];
+
+            TrackerState() {
+                strcpy(names[AllocationTracker::UNTAGGED], "Untagged");
+            }
+        };
+
+        // Intentionally leaked, allocations are still made and freed during static destruction
+        TrackerState& State() {
+            static TrackerState* state = new TrackerState();
+            return *state;
+        }
+
+        struct ThreadTagCounters {
+            i64 pendingBytes;
+            // Highest pendingBytes reached since the last publish
+            i64 pendingPeak;
+            u32 pendingAllocations;
+            u32 pendingDeallocations;
+        };
+
+        enum class ThreadCountersState : u8 {
+            // The exit flusher isn't registered yet
+            Fresh,
+            Active,
+            // The thread is exiting, every event is published immediately
+            Bypass
+        };
+
+        struct ThreadCounters {
+            ThreadTagCounters tags[AllocationTracker::MAX_TAGS];
+            u32 histogram[AllocationTracker::HISTOGRAM_BUCKETS];
+            ThreadCountersState state;
+        };
+
+        // Publishes the thread's counters when the thread exits. Kept separate from ThreadCounters so
+        // the counters stay trivially destructible and usable during thread teardown.
+        struct ThreadCountersFlusher {
+            bool registered = false;
+            ~ThreadCountersFlusher();
+        };
+
+        thread_local ThreadCounters tCounters = {};
+        thread_local ThreadCountersFlusher tCountersFlusher;
+
+        PYRO_FORCEINLINE usize HistogramBucket(usize size) {
+            return eastl::min<usize>(static_cast<usize>(std::bit_width(size)), AllocationTracker::HISTOGRAM_BUCKETS - 1);
+        }
+
+        void PublishTag(u16 tag, ThreadTagCounters& pending) {
+            GlobalTagCounters& counters = State().counters[tag];
+            if (pending.pendingBytes != 0 || pending.pendingPeak > 0) {
+                i64 live = counters.liveBytes.fetch_add(pending.pendingBytes, eastl::memory_order_relaxed);
+                // replay this thread's high-water mark on top of the live bytes it started from
+                i64 high = live + pending.pendingPeak;
+                i64 peak = counters.peakBytes.load(eastl::memory_order_relaxed);
+                while (high > peak && !counters.peakBytes.compare_exchange_weak(peak, high, eastl::memory_order_relaxed)) {
+                }
+            }
+            if (pending.pendingAllocations != 0) {
+                counters.allocationCount.fetch_add(pending.pendingAllocations, eastl::memory_order_relaxed);
+            }
+            if (pending.pendingDeallocations != 0) {
+                counters.deallocationCount.fetch_add(pending.pendingDeallocations, eastl::memory_order_relaxed);
+            }
+            pending = {};
+        }
+
+        void PublishHistogram() {
+            TrackerState& state = State();
+            for (usize i = 0; i < AllocationTracker::HISTOGRAM_BUCKETS; ++i) {
+                if (tCounters.histogram[i] != 0) {
+                    state.histogram[i].fetch_add(tCounters.histogram[i], eastl::memory_order_relaxed);
+                    tCounters.histogram[i] = 0;
+                }
+            }
+        }
+
+        PYRO_FORCEINLINE bool ShouldPublish(const ThreadTagCounters& pending) {
+            return pending.pendingBytes >= AllocationTracker::FLUSH_THRESHOLD_BYTES ||
+                   pending.pendingBytes <= -AllocationTracker::FLUSH_THRESHOLD_BYTES ||
+                   pending.pendingAllocations + pending.pendingDeallocations >= AllocationTracker::FLUSH_THRESHOLD_EVENTS ||
+                   tCounters.state != ThreadCountersState::Active;
+        }
+
+        void PublishSlow(u16 tag) {
+            if (tCounters.state == ThreadCountersState::Fresh) {
+                // touching the thread_local registers its destructor for this thread
+                tCountersFlusher.registered = true;
+                tCounters.state = ThreadCountersState::Active;
+            }
+            PublishTag(tag, tCounters.tags[tag]);
+            PublishHistogram();
+        }
+
+        ThreadCountersFlusher::~ThreadCountersFlusher() {
+            AllocationTracker::FlushThreadCounters();
+            tCounters.state = ThreadCountersState::Bypass;
+        }
+
+        void FillStats(u16 tag, AllocationTagStats& outStats) {
+            TrackerState& state = State();
+            const GlobalTagCounters& counters = state.counters[tag];
+            outStats.name = state.names[tag];
+            outStats.liveBytes = counters.liveBytes.load(eastl::memory_order_relaxed);
+            outStats.peakBytes = counters.peakBytes.load(eastl::memory_order_relaxed);
+            outStats.allocationCount = counters.allocationCount.load(eastl::memory_order_relaxed);
+            outStats.deallocationCount = counters.deallocationCount.load(eastl::memory_order_relaxed);
+        }
+    } // namespace
+
+    PYRO_COMMON_API u16 AllocationTracker::TagFromName(const char* name) noexcept {
+        if (!name || !*name) {
+            return UNTAGGED;
+        }
+        TrackerState& state = State();
+
+        usize hash = (reinterpret_cast<uptr>(name) >> 3) * 0x9E3779B97F4A7C15ull;
+        for (usize probe = 0; probe < 8; ++probe) {
+            TagCacheEntry& entry = state.cache[(hash + probe) & (TAG_CACHE_SIZE - 1)];
+            const char* cached = entry.name.load(eastl::memory_order_acquire);
+            if (cached == name) {
+                return entry.tag.load(eastl::memory_order_relaxed);
+            }
+            if (!cached) {
+                break;
+            }
+        }
+
+        std::lock_guard lock(state.registryMutex);
+        u16 count = state.tagCount.load(eastl::memory_order_relaxed);
+        u16 tag = UNTAGGED;
+        for (u16 i = 1; i < count; ++i) {
+            if (strncmp(state.names[i], name, MAX_TAG_NAME_LENGTH - 1) == 0) {
+                tag = i;
+                break;
+            }
+        }
+        if (tag == UNTAGGED && count < MAX_TAGS) {
+            tag = count;
+            strncpy(state.names[tag], name, MAX_TAG_NAME_LENGTH - 1);
+            state.tagCount.store(count + 1, eastl::memory_order_release);
+        }
+
+        for (usize probe = 0; probe < 8; ++probe) {
+            TagCacheEntry& entry = state.cache[(hash + probe) & (TAG_CACHE_SIZE - 1)];
+            const char* cached = entry.name.load(eastl::memory_order_relaxed);
+            if (cached == name) {
+                break;
+            }
+            if (!cached) {
+                entry.tag.store(tag, eastl::memory_order_relaxed);
+                entry.name.store(name, eastl::memory_order_release);
+                break;
+            }
+        }
+        return tag;
+    }
+
+    PYRO_COMMON_API void AllocationTracker::OnAllocate(u16 tag, usize size) noexcept {
+        ThreadTagCounters& pending = tCounters.tags[tag];
+        pending.pendingBytes += static_cast<i64>(size);
+        pending.pendingPeak = eastl::max(pending.pendingPeak, pending.pendingBytes);
+        ++pending.pendingAllocations;
+        ++tCounters.histogram[HistogramBucket(size)];
+        if (ShouldPublish(pending)) {
+            PublishSlow(tag);
+        }
+    }
+
+    PYRO_COMMON_API void AllocationTracker::OnDeallocate(u16 tag, usize size) noexcept {
+        ThreadTagCounters& pending = tCounters.tags[tag];
+        pending.pendingBytes -= static_cast<i64>(size);
+        ++pending.pendingDeallocations;
+        if (ShouldPublish(pending)) {
+            PublishSlow(tag);
+        }
+    }
+
+    PYRO_COMMON_API void AllocationTracker::FlushThreadCounters() noexcept {
+        for (u16 tag = 0; tag < MAX_TAGS; ++tag) {
+            PublishTag(tag, tCounters.tags[tag]);
+        }
+        PublishHistogram();
+    }
+
+    PYRO_COMMON_API bool AllocationTracker::QueryTag(const char* name, AllocationTagStats& outStats) {
+        FlushThreadCounters();
+        TrackerState& state = State();
+        u16 count = state.tagCount.load(eastl::memory_order_acquire);
+        for (u16 tag = 0; tag < count; ++tag) {
+            if (strncmp(state.names[tag], name, MAX_TAG_NAME_LENGTH - 1) == 0) {
+                FillStats(tag, outStats);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    PYRO_COMMON_API eastl::vector<AllocationTagStats> AllocationTracker::Snapshot() {
+        FlushThreadCounters();
+        u16 count = State().tagCount.load(eastl::memory_order_acquire);
+        eastl::vector<AllocationTagStats> result(count);
+        for (u16 tag = 0; tag < count; ++tag) {
+            FillStats(tag, result[tag]);
+        }
+        return result;
+    }
+
+    PYRO_COMMON_API AllocationTracker::SizeHistogram AllocationTracker::QuerySizeHistogram() {
+        FlushThreadCounters();
+        TrackerState& state = State();
+        SizeHistogram histogram = {};
+        for (usize i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+            histogram[i] = state.histogram[i].load(eastl::memory_order_relaxed);
+        }
+        return histogram;
+    }
+
+    PYRO_COMMON_API void AllocationTracker::Dump(ILogStream* stream, LogSeverity severity) {
+        eastl::vector<AllocationTagStats> stats = Snapshot();
+        for (const AllocationTagStats& tag : stats) {
+            if (tag.allocationCount == 0) {
+                continue;
+            }
+            Logger::LogFmt(severity, stream, "[Memory] {}: live {} B, peak {} B, {} allocations, {} frees",
+                tag.name, tag.liveBytes, tag.peakBytes, tag.allocationCount, tag.deallocationCount);
+        }
+
+        SizeHistogram histogram = QuerySizeHistogram();
+        for (usize i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+            if (histogram[i] == 0) {
+                continue;
+            }
+            u64 lower = i == 0 ? 0 : (u64(1) << (i - 1));
+            Logger::LogFmt(severity, stream, "[Memory] size >= {} B: {} allocations", lower, histogram[i]);
+        }
+    }
+} // namespace PyroshockStudios
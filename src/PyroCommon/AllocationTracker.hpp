@@ -0,0 +1,82 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    struct AllocationTagStats {
+        const char* name = nullptr;
+        i64 liveBytes = 0;
+        i64 peakBytes = 0;
+        u64 allocationCount = 0;
+        u64 deallocationCount = 0;
+    };
+
+    // Per-tag allocation accounting. With PYRO_COMMON_TRACK_ALLOCATIONS the MemoryOverload.hpp hooks
+    // report every array allocation here, tagged with the EASTL allocator name it was made with.
+    //
+    // Each thread accumulates its changes locally and publishes them to the global counters once they
+    // grow past a threshold, so the hot path never touches shared cache lines. Queried values can
+    // lag behind by up to FLUSH_THRESHOLD_BYTES per thread; FlushThreadCounters() publishes the
+    // calling thread's share immediately.
+    //
+    // Each thread also keeps the high-water mark of its pending bytes, so short spikes between two
+    // publishes still reach peakBytes. Spikes on different threads are combined as of their publish
+    // times though, so with several threads allocating the peak is an estimate, not an exact maximum.
+    class AllocationTracker {
+    public:
+        static constexpr u16 MAX_TAGS = 256;
+        static constexpr usize MAX_TAG_NAME_LENGTH = 64;
+        // Allocations without a name, and any tags past MAX_TAGS, are counted here
+        static constexpr u16 UNTAGGED = 0;
+
+        static constexpr i64 FLUSH_THRESHOLD_BYTES = 64 * 1024;
+        static constexpr u32 FLUSH_THRESHOLD_EVENTS = 256;
+
+        // Bucket i counts allocations with a size in [2^(i-1), 2^i), bucket 0 is zero-sized allocations
+        static constexpr usize HISTOGRAM_BUCKETS = 48;
+        using SizeHistogram = eastl::array<u64, HISTOGRAM_BUCKETS>;
+
+        // Returns the tag for a name, registering it on first use.
+        // Lookups are cached by pointer, so names are expected to be immutable (e.g. string literals).
+        PYRO_NODISCARD PYRO_COMMON_API static u16 TagFromName(const char* name) noexcept;
+
+        PYRO_COMMON_API static void OnAllocate(u16 tag, usize size) noexcept;
+        PYRO_COMMON_API static void OnDeallocate(u16 tag, usize size) noexcept;
+
+        // Publishes the calling thread's pending counters
+        PYRO_COMMON_API static void FlushThreadCounters() noexcept;
+
+        // Returns false if no tag with that name has been registered
+        PYRO_NODISCARD PYRO_COMMON_API static bool QueryTag(const char* name, AllocationTagStats& outStats);
+        PYRO_NODISCARD PYRO_COMMON_API static eastl::vector<AllocationTagStats> Snapshot();
+        PYRO_NODISCARD PYRO_COMMON_API static SizeHistogram QuerySizeHistogram();
+
+        // Logs one line per tag with live allocations, followed by the size histogram
+        PYRO_COMMON_API static void Dump(ILogStream* stream, LogSeverity severity = LogSeverity::Info);
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,166 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Allocator.hpp"
+#include "VirtualMemory.hpp"
+
+#include <EASTL/algorithm.h>
+#include <string.h>
+
+#ifndef PYRO_COMMON_ARENA_POISONING
+#ifndef NDEBUG
+#define PYRO_COMMON_ARENA_POISONING 1
+#else
+#define PYRO_COMMON_ARENA_POISONING 0
+#endif
+#endif
+
+namespace PyroshockStudios {
+    namespace {
+        // Fresh chunk memory and released memory get distinct patterns so stale reads stand out
+        constexpr u8 ARENA_UNINITIALIZED_PATTERN = 0xCD;
+        constexpr u8 ARENA_RELEASED_PATTERN = 0xDD;
+    } // namespace
+
+    PYRO_COMMON_API Arena::Arena(usize chunkSize, ArenaBacking backing) : mChunkSize(chunkSize), mBacking(backing) {
+        ASSERT(chunkSize > 0, "Arena chunk size must be non-zero!");
+    }
+
+    PYRO_COMMON_API Arena::~Arena() {
+        ReleaseMemory();
+    }
+
+    PYRO_COMMON_API void* Arena::AllocateSlow(usize size, usize alignment, usize offset) {
+        ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two!");
+
+        auto tryAllocate = [&](Chunk* chunk) -> void* {
+            uptr base = reinterpret_cast<uptr>(chunk->Data());
+            uptr ptr = PYRO_ALIGN(base + offset, alignment) - offset;
+            usize end = static_cast<usize>(ptr - base) + size;
+            if (end > chunk->capacity) {
+                return nullptr;
+            }
+            mCurrent = chunk;
+            mOffset = end;
+            return reinterpret_cast<void*>(ptr);
+        };
+
+        // Chunks past the current one are left over from before the last reset, reuse them first
+        Chunk* next = mCurrent ? mCurrent->next : mHead;
+        if (next) {
+            if (void* ptr = tryAllocate(next)) {
+                return ptr;
+            }
+        }
+
+        usize capacity = eastl::max(mChunkSize, size + alignment);
+        u8* memory = nullptr;
+        bool hugePages = false;
+        if (mBacking == ArenaBacking::HugePages) {
+            // mapped memory is already zeroed, poisoning it would fault in every page up front
+            usize mappingSize = PYRO_ALIGN(sizeof(Chunk) + capacity, VirtualMemory::HugePageSize());
+            VirtualMemory::PageBacking pageBacking;
+            memory = static_cast<u8*>(VirtualMemory::MapHugePages(mappingSize, &pageBacking));
+            if (!memory) {
+                return nullptr;
+            }
+            capacity = mappingSize - sizeof(Chunk);
+            hugePages = pageBacking != VirtualMemory::PageBacking::Normal;
+        } else {
+            memory = new u8[sizeof(Chunk) + capacity];
+#if PYRO_COMMON_ARENA_POISONING
+            memset(memory + sizeof(Chunk), ARENA_UNINITIALIZED_PATTERN, capacity);
+#endif
+        }
+        Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+        chunk->next = next;
+        chunk->capacity = capacity;
+        if (mCurrent) {
+            mCurrent->next = chunk;
+        } else {
+            mHead = chunk;
+        }
+        mReservedBytes += capacity;
+        if (hugePages) {
+            mHugePageBytes += capacity;
+        }
+
+        return tryAllocate(chunk);
+    }
+
+    PYRO_COMMON_API void Arena::Rewind(const Marker& marker) {
+        if (!marker.chunk) {
+            Reset();
+            return;
+        }
+#if PYRO_COMMON_ARENA_POISONING
+        for (Chunk* chunk = marker.chunk; chunk; chunk = chunk->next) {
+            usize begin = chunk == marker.chunk ? marker.offset : 0;
+            usize end = chunk == mCurrent ? mOffset : chunk->capacity;
+            if (end > begin) {
+                memset(chunk->Data() + begin, ARENA_RELEASED_PATTERN, end - begin);
+            }
+            if (chunk == mCurrent) {
+                break;
+            }
+        }
+#endif
+        mCurrent = marker.chunk;
+        mOffset = marker.offset;
+    }
+
+    PYRO_COMMON_API void Arena::Reset() {
+        if (!mHead) {
+            return;
+        }
+        Rewind({ mHead, 0 });
+    }
+
+    PYRO_COMMON_API void Arena::ReleaseMemory() {
+        Chunk* chunk = mHead;
+        while (chunk) {
+            Chunk* next = chunk->next;
+            if (mBacking == ArenaBacking::HugePages) {
+                VirtualMemory::Release(chunk, sizeof(Chunk) + chunk->capacity);
+            } else {
+                delete[] reinterpret_cast<u8*>(chunk);
+            }
+            chunk = next;
+        }
+        mHead = nullptr;
+        mCurrent = nullptr;
+        mOffset = 0;
+        mReservedBytes = 0;
+        mHugePageBytes = 0;
+    }
+
+    PYRO_COMMON_API usize Arena::UsedBytes() const {
+        usize used = 0;
+        for (Chunk* chunk = mHead; chunk; chunk = chunk->next) {
+            if (chunk == mCurrent) {
+                return used + mOffset;
+            }
+            used += chunk->capacity;
+        }
+        return used;
+    }
+} // namespace PyroshockStudios
@@ -21,3 +21,187 @@
 // SOFTWARE.
 
 #pragma once
+#include <PyroCommon/Core.hpp>
+
+#include <EASTL/allocator.h>
+#include <libassert/assert.hpp>
+
+#define PYRO_DEFAULT_ALIGNMENT (alignof(std::max_align_t))
+
+namespace PyroshockStudios {
+    // Type-erased allocation interface, for owners that can't be templated on an EASTL allocator
+    struct IAllocator {
+        IAllocator() = default;
+        virtual ~IAllocator() = default;
+
+        /// Allocates a block such that (ptr + offset) is aligned to `alignment`.
+        /// @return The block, or nullptr if the allocation failed.
+        PYRO_NODISCARD virtual void* Allocate(usize size, usize alignment = PYRO_DEFAULT_ALIGNMENT, usize offset = 0) = 0;
+
+        /// Returns a block previously handed out by Allocate.
+        virtual void Deallocate(void* ptr, usize size) = 0;
+    };
+
+    enum class ArenaBacking : u8 {
+        // Chunks come from the global heap
+        Heap,
+        // Chunks are mapped directly and backed by huge pages where the system allows, which cuts TLB misses
+        // on large long-lived buffers. Falls back to normal pages otherwise. Chunk sizes are rounded up
+        // to VirtualMemory::HugePageSize().
+        HugePages
+    };
+
+    // Bump-pointer arena for scratch memory with a short, well-defined lifetime (a frame, a request).
+    // Individual deallocations are no-ops; memory is reclaimed in bulk with Reset() or Rewind().
+    // Chunks are chained when the current one fills up and are kept around for reuse after a reset.
+    // Not thread-safe, use one arena per thread.
+    class Arena final : public IAllocator, DeleteCopy, DeleteMove {
+        struct alignas(PYRO_DEFAULT_ALIGNMENT) Chunk {
+            Chunk* next;
+            usize capacity;
+
+            PYRO_FORCEINLINE u8* Data() noexcept { return reinterpret_cast<u8*>(this + 1); }
+        };
+
+    public:
+        // Position in the arena that can be rewound to later
+        struct Marker {
+            Chunk* chunk = nullptr;
+            usize offset = 0;
+        };
+
+        PYRO_COMMON_API explicit Arena(usize chunkSize = 64 * 1024, ArenaBacking backing = ArenaBacking::Heap);
+        PYRO_COMMON_API ~Arena();
+
+        PYRO_NODISCARD PYRO_FORCEINLINE void* Allocate(usize size, usize alignment = PYRO_DEFAULT_ALIGNMENT, usize offset = 0) override {
+            if (mCurrent) {
+                uptr base = reinterpret_cast<uptr>(mCurrent->Data());
+                uptr ptr = PYRO_ALIGN(base + mOffset + offset, alignment) - offset;
+                usize end = static_cast<usize>(ptr - base) + size;
+                if (end <= mCurrent->capacity) {
+                    mOffset = end;
+                    return reinterpret_cast<void*>(ptr);
+                }
+            }
+            return AllocateSlow(size, alignment, offset);
+        }
+
+        PYRO_FORCEINLINE void Deallocate(void*, usize) override {}
+
+        PYRO_NODISCARD PYRO_FORCEINLINE Marker GetMarker() const noexcept {
+            return { mCurrent, mOffset };
+        }
+
+        // Releases everything allocated after the marker was taken
+        PYRO_COMMON_API void Rewind(const Marker& marker);
+
+        // Releases every allocation in O(1), keeping the chunks for reuse
+        PYRO_COMMON_API void Reset();
+
+        // Releases every allocation and returns all chunks to the heap
+        PYRO_COMMON_API void ReleaseMemory();
+
+        // Bytes consumed since the last reset, including alignment padding and skipped chunk tails
+        PYRO_NODISCARD PYRO_COMMON_API usize UsedBytes() const;
+        // Bytes held in chunks
+        PYRO_NODISCARD PYRO_FORCEINLINE usize ReservedBytes() const noexcept { return mReservedBytes; }
+        // Bytes held in chunks that the OS backs with huge pages, explicitly or transparently
+        PYRO_NODISCARD PYRO_FORCEINLINE usize HugePageBytes() const noexcept { return mHugePageBytes; }
+        PYRO_NODISCARD PYRO_FORCEINLINE ArenaBacking Backing() const noexcept { return mBacking; }
+
+    private:
+        PYRO_COMMON_API void* AllocateSlow(usize size, usize alignment, usize offset);
+
+        Chunk* mHead = nullptr;
+        Chunk* mCurrent = nullptr;
+        usize mOffset = 0;
+        usize mChunkSize = 0;
+        usize mReservedBytes = 0;
+        usize mHugePageBytes = 0;
+        ArenaBacking mBacking = ArenaBacking::Heap;
+    };
+
+    namespace internal {
+        // EASTL containers never check for nullptr, so running out is fatal like it is with the default allocator
+        PYRO_FORCEINLINE void* CheckAllocation(void* ptr, usize size) {
+            if (!ptr) {
+                PANIC("Out of memory!", size);
+            }
+            return ptr;
+        }
+    } // namespace internal
+
+    // EASTL allocator that allocates from an Arena, e.g. eastl::vector<T, ArenaAllocator>
+    class ArenaAllocator {
+    public:
+        explicit ArenaAllocator(const char* name = "ArenaAllocator") : mName(name) {}
+        explicit ArenaAllocator(Arena* arena, const char* name = "ArenaAllocator") : mArena(arena), mName(name) {}
+        ArenaAllocator(const ArenaAllocator& other) = default;
+        ArenaAllocator(const ArenaAllocator& other, const char* name) : mArena(other.mArena), mName(name) {}
+        ArenaAllocator& operator=(const ArenaAllocator& other) = default;
+
+        PYRO_FORCEINLINE void* allocate(usize n, int flags = 0) {
+            ASSERT(mArena != nullptr, "ArenaAllocator has no arena bound!");
+            return internal::CheckAllocation(mArena->Allocate(n, EASTL_ALLOCATOR_MIN_ALIGNMENT, 0), n);
+        }
+        PYRO_FORCEINLINE void* allocate(usize n, usize alignment, usize offset, int flags = 0) {
+            ASSERT(mArena != nullptr, "ArenaAllocator has no arena bound!");
+            return internal::CheckAllocation(mArena->Allocate(n, alignment, offset), n);
+        }
+        PYRO_FORCEINLINE void deallocate(void*, usize) {}
+
+        const char* get_name() const { return mName; }
+        void set_name(const char* name) { mName = name; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE Arena* GetArena() const noexcept { return mArena; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator==(const ArenaAllocator& other) const noexcept { return mArena == other.mArena; }
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator!=(const ArenaAllocator& other) const noexcept { return mArena != other.mArena; }
+
+    private:
+        Arena* mArena = nullptr;
+        const char* mName = nullptr;
+    };
+
+    // EASTL allocator that forwards to an IAllocator, or to the default EASTL allocator when none is bound
+    class PolymorphicAllocator {
+    public:
+        explicit PolymorphicAllocator(const char* name = "PolymorphicAllocator") : mName(name) {}
+        explicit PolymorphicAllocator(IAllocator* allocator, const char* name = "PolymorphicAllocator") : mAllocator(allocator), mName(name) {}
+        PolymorphicAllocator(const PolymorphicAllocator& other) = default;
+        PolymorphicAllocator(const PolymorphicAllocator& other, const char* name) : mAllocator(other.mAllocator), mName(name) {}
+        PolymorphicAllocator& operator=(const PolymorphicAllocator& other) = default;
+
+        PYRO_FORCEINLINE void* allocate(usize n, int flags = 0) {
+            if (!mAllocator) {
+                return EASTLAllocatorDefault()->allocate(n, flags);
+            }
+            return internal::CheckAllocation(mAllocator->Allocate(n, EASTL_ALLOCATOR_MIN_ALIGNMENT, 0), n);
+        }
+        PYRO_FORCEINLINE void* allocate(usize n, usize alignment, usize offset, int flags = 0) {
+            if (!mAllocator) {
+                return EASTLAllocatorDefault()->allocate(n, alignment, offset, flags);
+            }
+            return internal::CheckAllocation(mAllocator->Allocate(n, alignment, offset), n);
+        }
+        PYRO_FORCEINLINE void deallocate(void* ptr, usize n) {
+            if (!mAllocator) {
+                EASTLAllocatorDefault()->deallocate(ptr, n);
+                return;
+            }
+            mAllocator->Deallocate(ptr, n);
+        }
+
+        const char* get_name() const { return mName; }
+        void set_name(const char* name) { mName = name; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE IAllocator* GetAllocator() const noexcept { return mAllocator; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator==(const PolymorphicAllocator& other) const noexcept { return mAllocator == other.mAllocator; }
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator!=(const PolymorphicAllocator& other) const noexcept { return mAllocator != other.mAllocator; }
+
+    private:
+        IAllocator* mAllocator = nullptr;
+        const char* mName = nullptr;
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,155 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Memory.hpp>
+
+#include <libassert/assert.hpp>
+
+// Top-byte tagged heap pointers (ARM TBI as used by Android, MTE, HWASan) carry bits above the low 48,
+// packing them with the borrow count below would strip the tag
+#if defined(__has_feature)
+#if __has_feature(hwaddress_sanitizer)
+#define PYRO_COMMON_TAGGED_POINTERS 1
+#endif
+#endif
+#if defined(__SANITIZE_HWADDRESS__) || defined(__ARM_FEATURE_MEMORY_TAGGING) || \
+    (defined(__ANDROID__) && defined(__aarch64__))
+#define PYRO_COMMON_TAGGED_POINTERS 1
+#endif
+#ifdef PYRO_COMMON_TAGGED_POINTERS
+#error "AtomicSharedRef isn't supported on targets with tagged pointers"
+#endif
+
+namespace PyroshockStudios {
+    // SharedRef slot that can be read and replaced from any thread without a lock, for publishing
+    // configuration, lookup tables and other read-mostly objects.
+    // Uses split reference counts: the pointer shares a 64-bit word with a count of references that readers
+    // borrowed from the slot. A reader bumps that count, takes a real reference, then gives the borrow back.
+    // A writer that swaps the pointer out converts the borrows still in flight into real references,
+    // which those readers release. T must use an atomic ref-counting policy.
+    template <typename T>
+    class AtomicSharedRef : DeleteCopy, DeleteMove {
+#if UINTPTR_MAX > 0xFFFFFFFFu
+        // User-space pointers fit in the low 48 bits on all supported 64-bit targets, tagged pointer targets are rejected above
+        static constexpr u32 POINTER_BITS = 48;
+#else
+        static constexpr u32 POINTER_BITS = 32;
+#endif
+        static constexpr u64 POINTER_MASK = (u64(1) << POINTER_BITS) - 1;
+        static constexpr u64 ONE_BORROW = u64(1) << POINTER_BITS;
+
+        mutable eastl::atomic<u64> mWord = { 0 };
+
+        PYRO_NODISCARD PYRO_FORCEINLINE static T* Pointer(u64 word) noexcept {
+            return reinterpret_cast<T*>(static_cast<uptr>(word & POINTER_MASK));
+        }
+        PYRO_NODISCARD PYRO_FORCEINLINE static u32 Borrows(u64 word) noexcept {
+            return static_cast<u32>(word >> POINTER_BITS);
+        }
+        PYRO_NODISCARD PYRO_FORCEINLINE static u64 Pack(T* ptr) noexcept {
+            u64 word = static_cast<u64>(reinterpret_cast<uptr>(ptr));
+            ASSERT((word & ~POINTER_MASK) == 0, "Pointer doesn't fit into AtomicSharedRef's pointer bits!");
+            return word;
+        }
+
+        // Called with a word that was just swapped out of the slot, the slot's own reference is handed to the caller
+        PYRO_NODISCARD PYRO_FORCEINLINE static T* Retire(u64 word) noexcept {
+            T* ptr = Pointer(word);
+            if (ptr && Borrows(word) > 0) {
+                ptr->AddRef(Borrows(word));
+            }
+            return ptr;
+        }
+
+    public:
+        AtomicSharedRef() = default;
+        explicit AtomicSharedRef(SharedRef<T> ref) : mWord(Pack(ref.Detach())) {}
+        ~AtomicSharedRef() {
+            if (T* ptr = Pointer(mWord.load(eastl::memory_order_acquire))) {
+                ptr->Release();
+            }
+        }
+
+        PYRO_NODISCARD SharedRef<T> Load() const noexcept {
+            u64 word = mWord.fetch_add(ONE_BORROW, eastl::memory_order_acquire);
+            T* ptr = Pointer(word);
+            if (!ptr) {
+                ReturnBorrow(nullptr);
+                return nullptr;
+            }
+            // the borrow keeps the object alive, either through the slot or as a reference a writer handed over
+            ptr->AddRef();
+            ReturnBorrow(ptr);
+            return SharedRef<T>::Adopt(ptr);
+        }
+
+        void Store(SharedRef<T> desired) noexcept {
+            SharedRef<T> previous = Exchange(eastl::move(desired));
+        }
+
+        PYRO_NODISCARD SharedRef<T> Exchange(SharedRef<T> desired) noexcept {
+            u64 previous = mWord.exchange(Pack(desired.Detach()), eastl::memory_order_acq_rel);
+            return SharedRef<T>::Adopt(Retire(previous));
+        }
+
+        // Replaces the value with `desired` if it still points at the same object as `expected`.
+        // Otherwise `expected` is updated to the current value.
+        bool CompareExchange(SharedRef<T>& expected, SharedRef<T> desired) noexcept {
+            u64 word = mWord.load(eastl::memory_order_acquire);
+            while (true) {
+                if (Pointer(word) != expected.Get()) {
+                    SharedRef<T> current = Load();
+                    if (current.Get() != expected.Get()) {
+                        expected = eastl::move(current);
+                        return false;
+                    }
+                    word = mWord.load(eastl::memory_order_acquire);
+                    continue;
+                }
+                u64 replacement = Pack(desired.Get());
+                if (mWord.compare_exchange_weak(word, replacement, eastl::memory_order_acq_rel, eastl::memory_order_acquire)) {
+                    (void)desired.Detach();
+                    // drops the slot's reference to the replaced object
+                    SharedRef<T> previous = SharedRef<T>::Adopt(Retire(word));
+                    return true;
+                }
+            }
+        }
+
+    private:
+        void ReturnBorrow(T* ptr) const noexcept {
+            u64 word = mWord.load(eastl::memory_order_relaxed);
+            // borrows of the same pointer are interchangeable, so a pointer that was swapped out and back in
+            // still takes the borrow back as long as one is outstanding
+            while (Pointer(word) == ptr && Borrows(word) > 0) {
+                if (mWord.compare_exchange_weak(word, word - ONE_BORROW, eastl::memory_order_release, eastl::memory_order_relaxed)) {
+                    return;
+                }
+            }
+            // a writer swapped the pointer out and turned the borrow into a reference
+            if (ptr) {
+                ptr->Release();
+            }
+        }
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -56,7 +56,7 @@ namespace PyroshockStudios {
             bool OverrideOption(const eastl::string& key, const eastl::string& value);
 
             template <typename Fn>
-            void QueryOptions(Fn&& fn) {
+            void QueryOptions(Fn&& fn) const {
                 for (const auto& kv : mOptions) {
                     fn(kv.first, kv.second);
                 }
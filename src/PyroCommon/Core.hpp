@@ -21,7 +21,6 @@
 // SOFTWARE.
 
 #pragma once
-#include <PyroCommon/Allocator.hpp>
 #include <PyroCommon/Concepts.hpp>
 #include <PyroCommon/Platform.hpp>
 #include <PyroCommon/Traits.hpp>
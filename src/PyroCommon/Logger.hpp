@@ -25,24 +25,79 @@
 #include <EASTL/string.h>
 #include <PyroCommon/Core.hpp>
 #include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Logging/LogChannel.hpp>
+#include <PyroCommon/Logging/LogSuppression.hpp>
 #include <fmt/format.h>
+#include <source_location>
+
+// Log calls below this severity are compiled out, set to the name of a LogSeverity (e.g. Info).
+// The PYRO_LOG_* macros don't evaluate their arguments below it either.
+#ifndef PYRO_COMMON_MIN_LOG_SEVERITY
+#define PYRO_COMMON_MIN_LOG_SEVERITY Verbose
+#endif
 
 namespace PyroshockStudios {
     class Logger {
     public:
+#ifdef PYRO_COMMON_DISABLE_VERBOSE_LOGGING
+        // kept for compatibility, same as a minimum of at least Debug
+        static constexpr LogSeverity MIN_SEVERITY = LogSeverity::PYRO_COMMON_MIN_LOG_SEVERITY > LogSeverity::Debug
+                                                        ? LogSeverity::PYRO_COMMON_MIN_LOG_SEVERITY
+                                                        : LogSeverity::Debug;
+#else
+        static constexpr LogSeverity MIN_SEVERITY = LogSeverity::PYRO_COMMON_MIN_LOG_SEVERITY;
+#endif
+
+        PYRO_NODISCARD static constexpr bool IsCompiledIn(LogSeverity severity) {
+            return severity >= MIN_SEVERITY;
+        }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE static bool IsEnabled(ILogStream* stream, LogSeverity severity) {
+            return stream && severity >= stream->MinSeverity();
+        }
+        PYRO_NODISCARD PYRO_FORCEINLINE static bool IsEnabled(const LogChannel& channel, LogSeverity severity) {
+            return channel.IsEnabled(severity);
+        }
+
         template <typename... Args>
         static void LogFmt(LogSeverity severity, ILogStream* stream, fmt::format_string<Args...> format_str, Args&&... args) {
-            if (!stream || severity < stream->MinSeverity())
+            if (!IsCompiledIn(severity) || !stream || severity < stream->MinSeverity())
+                return;
+            // formats on the stack, only messages past the inline capacity of the buffer allocate
+            fmt::memory_buffer buffer;
+            fmt::format_to(fmt::appender(buffer), format_str, std::forward<Args>(args)...);
+            buffer.push_back('\0');
+            stream->Log(severity, buffer.data(), buffer.size() - 1);
+        }
+
+        template <typename... Args>
+        static void LogFmt(LogSeverity severity, const LogChannel& channel, fmt::format_string<Args...> format_str, Args&&... args) {
+            if (!IsCompiledIn(severity) || !channel.IsEnabled(severity))
                 return;
-            auto result = fmt::format(format_str, std::forward<Args>(args)...);
-            stream->Log(severity, result.c_str());
+            LogFmt(severity, channel.Stream(), eastl::move(format_str), std::forward<Args>(args)...);
         }
 
+        /// Used by the PYRO_LOG_* macros, which declare `site` and `state`, strip calls below MIN_SEVERITY and check IsEnabled first.
+        /// Storms from one call site are rate limited and coalesced, see LogSuppressionConfig.
+        template <typename... Args>
+        static void LogAt(const LogSite& site, LogSiteState& state, ILogStream* stream, fmt::format_string<Args...> format_str, Args&&... args) {
+            fmt::memory_buffer buffer;
+            fmt::format_to(fmt::appender(buffer), format_str, std::forward<Args>(args)...);
+            buffer.push_back('\0');
+            state.Submit(site, stream, buffer.data(), buffer.size() - 1);
+        }
+        template <typename... Args>
+        static void LogAt(const LogSite& site, LogSiteState& state, const LogChannel& channel, fmt::format_string<Args...> format_str, Args&&... args) {
+            // the stream can be swapped between the check and here, not worth another check on every message
+            if (ILogStream* stream = channel.Stream()) {
+                LogAt(site, state, stream, eastl::move(format_str), std::forward<Args>(args)...);
+            }
+        }
+
+        // The arguments of these are still evaluated when their severity is compiled out, prefer the PYRO_LOG_* macros
         template <typename... Args>
         PYRO_FORCEINLINE static void Verbose(ILogStream* stream, fmt::format_string<Args...> format_str, Args&&... args) {
-#ifndef PYRO_COMMON_DISABLE_VERBOSE_LOGGING
             LogFmt(LogSeverity::Verbose, stream, eastl::move(format_str), std::forward<Args>(args)...);
-#endif
         }
         template <typename... Args>
         PYRO_FORCEINLINE static void Debug(ILogStream* stream, fmt::format_string<Args...> format_str, Args&&... args) {
@@ -69,4 +124,38 @@ namespace PyroshockStudios {
             LogFmt(LogSeverity::Fatal, stream, eastl::move(format_str), std::forward<Args>(args)...);
         }
     };
-} // namespace PyroshockStudios
\ No newline at end of file
+} // namespace PyroshockStudios
+
+// Declares `name` as the static LogSite of the calling line, for macros wrapping other log entry points
+#define PYRO_LOG_DECLARE_SITE(name, severity, format)      \
+    static constexpr ::PyroshockStudios::LogSite name = {  \
+        __FILE__,                                          \
+        ::std::source_location::current().function_name(), \
+        __LINE__,                                          \
+        ::PyroshockStudios::LogSeverity::severity,         \
+        format,                                            \
+    }
+
+// Logs with `severity` (a LogSeverity name) and static call-site metadata to an ILogStream* or a LogChannel.
+// Compiles to nothing below PYRO_COMMON_MIN_LOG_SEVERITY, and the arguments are only evaluated if the target is enabled.
+// Each call site is rate limited and coalesces repeated messages, see LogSuppression.
+#define PYRO_LOG(severity, stream, format, ...)                                                                    \
+    do {                                                                                                           \
+        if constexpr (::PyroshockStudios::Logger::IsCompiledIn(::PyroshockStudios::LogSeverity::severity)) {       \
+            auto&& pyroLogTarget = (stream);                                                                       \
+            if (::PyroshockStudios::Logger::IsEnabled(pyroLogTarget, ::PyroshockStudios::LogSeverity::severity)) { \
+                PYRO_LOG_DECLARE_SITE(pyroLogSite, severity, format);                                              \
+                static ::PyroshockStudios::LogSiteState pyroLogState;                                              \
+                ::PyroshockStudios::Logger::LogAt(pyroLogSite, pyroLogState, pyroLogTarget,                        \
+                                                  format __VA_OPT__(, ) __VA_ARGS__);                              \
+            }                                                                                                      \
+        }                                                                                                          \
+    } while (0)
+
+#define PYRO_LOG_VERBOSE(stream, format, ...) PYRO_LOG(Verbose, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_DEBUG(stream, format, ...) PYRO_LOG(Debug, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_TRACE(stream, format, ...) PYRO_LOG(Trace, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_INFO(stream, format, ...) PYRO_LOG(Info, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_WARN(stream, format, ...) PYRO_LOG(Warn, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_ERROR(stream, format, ...) PYRO_LOG(Error, stream, format __VA_OPT__(, ) __VA_ARGS__)
+#define PYRO_LOG_FATAL(stream, format, ...) PYRO_LOG(Fatal, stream, format __VA_OPT__(, ) __VA_ARGS__)
\ No newline at end of file
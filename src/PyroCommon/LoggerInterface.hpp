@@ -34,11 +34,30 @@ namespace PyroshockStudios {
         Fatal = 6
     };
 
+    // Static description of a log call site, the PYRO_LOG_* macros in Logger.hpp create one per call
+    struct LogSite {
+        const char* file;
+        const char* function;
+        u32 line;
+        LogSeverity severity;
+        // The format string before formatting
+        const char* format;
+    };
+
     struct ILogStream {
         ILogStream() = default;
         ~ILogStream() = default;
 
         virtual void Log(LogSeverity severity, const char* message) = 0;
+        // `message` is still null-terminated, streams that can use the length override this to skip the strlen
+        virtual void Log(LogSeverity severity, const char* message, usize length) {
+            (void)length;
+            Log(severity, message);
+        }
+        // Called by the PYRO_LOG_* macros, `site` has static storage duration so streams may keep the pointer
+        virtual void Log(const LogSite& site, const char* message, usize length) {
+            Log(site.severity, message, length);
+        }
         virtual LogSeverity MinSeverity() const = 0;
         virtual const char* Name() const = 0;
     };
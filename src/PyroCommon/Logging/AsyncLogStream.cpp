@@ -0,0 +1,228 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AsyncLogStream.hpp"
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <bit>
+#include <fmt/format.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        // How long the sink thread sleeps when a producer's wake-up raced with it going to sleep
+        constexpr auto SINK_THREAD_IDLE_TIMEOUT = std::chrono::milliseconds(10);
+    } // namespace
+
+    PYRO_COMMON_API AsyncLogStream::AsyncLogStream(eastl::span<ILogStream* const> sinks, u32 capacity, LogOverflowPolicy policy)
+        : mPolicy(policy), mSinks(sinks.begin(), sinks.end()) {
+        capacity = std::bit_ceil(eastl::max(capacity, 2u));
+        mMask = capacity - 1;
+        mSlots = new internal::AsyncLogSlot[capacity];
+        for (u32 i = 0; i < capacity; ++i) {
+            mSlots[i].sequence.store(i, eastl::memory_order_relaxed);
+            mSlots[i].heapPayload = nullptr;
+        }
+        for (ILogStream* sink : mSinks) {
+            if (sink->MinSeverity() < mMinSeverity) {
+                mMinSeverity = sink->MinSeverity();
+            }
+        }
+        mSinkThread = std::thread([this]() { SinkThreadMain(); });
+    }
+
+    PYRO_COMMON_API AsyncLogStream::~AsyncLogStream() {
+        LogSuppression::RemoveStream(this);
+        {
+            std::lock_guard lock(mMutex);
+            mStopping.store(true, eastl::memory_order_release);
+        }
+        mWake.notify_one();
+        mSinkThread.join();
+        delete[] mSlots;
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        if (severity < mMinSeverity) {
+            return;
+        }
+        internal::AsyncLogSlot* slot = AcquireSlot();
+        if (!slot) {
+            return;
+        }
+        // the terminator is copied too, sinks get a null-terminated message either way
+        memcpy(ReservePayload(*slot, severity, nullptr, length + 1, nullptr), message, length + 1);
+        Publish(*slot);
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Log(const LogSite& site, const char* message, usize length) {
+        if (site.severity < mMinSeverity) {
+            return;
+        }
+        internal::AsyncLogSlot* slot = AcquireSlot();
+        if (!slot) {
+            return;
+        }
+        memcpy(ReservePayload(*slot, site.severity, &site, length + 1, nullptr), message, length + 1);
+        Publish(*slot);
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Flush() {
+        LogSuppression::FlushPending(this);
+        const u64 target = mEnqueuePos.load(eastl::memory_order_acquire);
+        std::unique_lock lock(mMutex);
+        mWake.notify_one();
+        mFlushed.wait(lock, [&]() { return mDelivered.load(eastl::memory_order_acquire) >= target; });
+    }
+
+    PYRO_COMMON_API internal::AsyncLogSlot* AsyncLogStream::TryAcquireSlot() {
+        // bounded MPMC queue by Dmitry Vyukov, only ever drained by the sink thread
+        u64 pos = mEnqueuePos.load(eastl::memory_order_relaxed);
+        for (;;) {
+            internal::AsyncLogSlot* slot = &mSlots[pos & mMask];
+            const u64 sequence = slot->sequence.load(eastl::memory_order_acquire);
+            const i64 diff = static_cast<i64>(sequence) - static_cast<i64>(pos);
+            if (diff == 0) {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, eastl::memory_order_relaxed)) {
+                    return slot;
+                }
+            } else if (diff < 0) {
+                // the slot still holds a message from the previous lap
+                return nullptr;
+            } else {
+                pos = mEnqueuePos.load(eastl::memory_order_relaxed);
+            }
+        }
+    }
+
+    PYRO_COMMON_API internal::AsyncLogSlot* AsyncLogStream::AcquireSlot() {
+        internal::AsyncLogSlot* slot = TryAcquireSlot();
+        if (slot) {
+            return slot;
+        }
+        if (mPolicy != LogOverflowPolicy::Block) {
+            mDropped.fetch_add(1, eastl::memory_order_relaxed);
+            return nullptr;
+        }
+        do {
+            WakeSinkThread();
+            std::this_thread::yield();
+            slot = TryAcquireSlot();
+        } while (!slot);
+        return slot;
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::WakeSinkThread() {
+        std::lock_guard lock(mMutex);
+        mWake.notify_one();
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::SinkThreadMain() {
+        for (;;) {
+            if (Drain() > 0) {
+                continue;
+            }
+            if (mStopping.load(eastl::memory_order_acquire)) {
+                // producers are gone by the time the stream is destroyed, this catches the last stragglers
+                Drain();
+                return;
+            }
+
+            std::unique_lock lock(mMutex);
+            mSinkThreadWaiting.store(true, eastl::memory_order_relaxed);
+            eastl::atomic_thread_fence(eastl::memory_order_seq_cst);
+            const internal::AsyncLogSlot& next = mSlots[mDequeuePos & mMask];
+            if (next.sequence.load(eastl::memory_order_acquire) != mDequeuePos + 1 && !mStopping.load(eastl::memory_order_relaxed)) {
+                mWake.wait_for(lock, SINK_THREAD_IDLE_TIMEOUT);
+            }
+            mSinkThreadWaiting.store(false, eastl::memory_order_relaxed);
+        }
+    }
+
+    PYRO_COMMON_API u32 AsyncLogStream::Drain() {
+        u32 drained = 0;
+        for (;;) {
+            internal::AsyncLogSlot& slot = mSlots[mDequeuePos & mMask];
+            if (slot.sequence.load(eastl::memory_order_acquire) != mDequeuePos + 1) {
+                break;
+            }
+            const u8* payload = slot.heapPayload ? slot.heapPayload : slot.inlinePayload;
+            if (slot.formatter) {
+                mFormatBuffer.clear();
+                slot.formatter(mFormatBuffer, payload);
+                mFormatBuffer.push_back('\0');
+                Deliver(slot, mFormatBuffer.data(), mFormatBuffer.size() - 1);
+            } else {
+                Deliver(slot, reinterpret_cast<const char*>(payload), slot.payloadSize - 1);
+            }
+            if (slot.heapPayload) {
+                delete[] slot.heapPayload;
+                slot.heapPayload = nullptr;
+            }
+            // hand the slot to the producer of the next lap
+            slot.sequence.store(mDequeuePos + mMask + 1, eastl::memory_order_release);
+            ++mDequeuePos;
+            ++drained;
+        }
+
+        if (mPolicy == LogOverflowPolicy::DropAndReport) {
+            const u64 dropped = mDropped.load(eastl::memory_order_relaxed);
+            if (dropped != mReportedDrops) {
+                auto report = fmt::format("[AsyncLogStream] Ring full, dropped {} messages", dropped - mReportedDrops);
+                Deliver(LogSeverity::Warn, report.c_str(), report.size());
+                mReportedDrops = dropped;
+            }
+        }
+
+        if (drained > 0) {
+            mDelivered.store(mDequeuePos, eastl::memory_order_release);
+            std::lock_guard lock(mMutex);
+            mFlushed.notify_all();
+        }
+        return drained;
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Deliver(const internal::AsyncLogSlot& slot, const char* message, usize length) {
+        if (!slot.site) {
+            Deliver(slot.severity, message, length);
+            return;
+        }
+        for (ILogStream* sink : mSinks) {
+            if (slot.severity >= sink->MinSeverity()) {
+                sink->Log(*slot.site, message, length);
+            }
+        }
+    }
+
+    PYRO_COMMON_API void AsyncLogStream::Deliver(LogSeverity severity, const char* message, usize length) {
+        for (ILogStream* sink : mSinks) {
+            if (severity >= sink->MinSeverity()) {
+                sink->Log(severity, message, length);
+            }
+        }
+    }
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,183 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Logging/DeferredFormat.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace PyroshockStudios {
+    // What a producer does when the ring of an AsyncLogStream is full
+    enum class LogOverflowPolicy : u8 {
+        // Wait for the sink thread to make room, nothing is lost
+        Block,
+        // Discard the message, DroppedCount() keeps track
+        Drop,
+        // Discard the message and have the sink thread log how many were lost once it catches up
+        DropAndReport
+    };
+
+    namespace internal {
+        struct alignas(64) AsyncLogSlot {
+            static constexpr usize INLINE_CAPACITY = 256 - sizeof(u64) - sizeof(LogSeverity) - sizeof(u32) - sizeof(u8*) - sizeof(DeferredLogFormatter) - sizeof(const LogSite*);
+
+            eastl::atomic<u64> sequence;
+            LogSeverity severity;
+            u32 payloadSize;
+            // Payloads that don't fit inline, owned by the slot until the sink thread is done with it
+            u8* heapPayload;
+            // Null if the payload is the message text, otherwise formats the captured arguments
+            DeferredLogFormatter formatter;
+            // Set for messages logged through the PYRO_LOG_* macros
+            const LogSite* site;
+            u8 inlinePayload[INLINE_CAPACITY];
+        };
+    } // namespace internal
+
+    // ILogStream that copies messages into a bounded lock-free multi-producer ring and hands them to the
+    // wrapped sinks on a dedicated thread, so slow sinks never stall the logging thread.
+    // The sinks are only ever called from that thread and must outlive the stream.
+    class AsyncLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        static constexpr u32 DEFAULT_CAPACITY = 4096;
+
+        /// `capacity` is the number of messages the ring holds and is rounded up to a power of two.
+        PYRO_COMMON_API explicit AsyncLogStream(eastl::span<ILogStream* const> sinks, u32 capacity = DEFAULT_CAPACITY,
+            LogOverflowPolicy policy = LogOverflowPolicy::Block);
+        /// Delivers everything still queued before returning.
+        PYRO_COMMON_API ~AsyncLogStream();
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_COMMON_API void Log(const LogSite& site, const char* message, usize length) override;
+
+        /// Captures the arguments as raw bytes and leaves the formatting to the sink thread.
+        /// Strings are copied, everything else must be trivially copyable. `format` must be a string literal.
+        template <DeferredLogArgConcept... Args>
+        PYRO_FORCEINLINE void LogDeferred(LogSeverity severity, fmt::format_string<internal::DeferredLogArg<Args>...> format, const Args&... args) {
+            CaptureDeferred(severity, nullptr, static_cast<fmt::string_view>(format), args...);
+        }
+
+        /// Same as above with static call-site metadata, used by PYRO_LOG_DEFERRED.
+        template <DeferredLogArgConcept... Args>
+        PYRO_FORCEINLINE void LogDeferredAt(const LogSite& site, fmt::format_string<internal::DeferredLogArg<Args>...> format, const Args&... args) {
+            CaptureDeferred(site.severity, &site, static_cast<fmt::string_view>(format), args...);
+        }
+        PYRO_NODISCARD LogSeverity MinSeverity() const override { return mMinSeverity; }
+        PYRO_NODISCARD const char* Name() const override { return "AsyncLogStream"; }
+
+        /// Blocks until every message logged before the call has been handed to the sinks.
+        PYRO_COMMON_API void Flush();
+
+        /// Messages discarded because the ring was full, counted under every policy.
+        PYRO_NODISCARD u64 DroppedCount() const noexcept { return mDropped.load(eastl::memory_order_relaxed); }
+        PYRO_NODISCARD u32 Capacity() const noexcept { return mMask + 1; }
+        PYRO_NODISCARD LogOverflowPolicy Policy() const noexcept { return mPolicy; }
+
+    private:
+        template <typename... Args>
+        PYRO_FORCEINLINE void CaptureDeferred(LogSeverity severity, const LogSite* site, fmt::string_view format, const Args&... args) {
+            if (severity < mMinSeverity) {
+                return;
+            }
+            internal::AsyncLogSlot* slot = AcquireSlot();
+            if (!slot) {
+                return;
+            }
+            const usize size = internal::DeferredLogSize(args...);
+            u8* payload = ReservePayload(*slot, severity, site, size, &internal::FormatDeferredLog<eastl::decay_t<Args>...>);
+            internal::EncodeDeferredLog(payload, format, args...);
+            Publish(*slot);
+        }
+
+        PYRO_NODISCARD PYRO_COMMON_API internal::AsyncLogSlot* TryAcquireSlot();
+        /// Applies the overflow policy, returns null if the message is dropped.
+        PYRO_NODISCARD PYRO_COMMON_API internal::AsyncLogSlot* AcquireSlot();
+
+        PYRO_NODISCARD PYRO_FORCEINLINE static u8* ReservePayload(internal::AsyncLogSlot& slot, LogSeverity severity, const LogSite* site,
+            usize size, internal::DeferredLogFormatter formatter) {
+            slot.severity = severity;
+            slot.site = site;
+            slot.payloadSize = static_cast<u32>(size);
+            slot.formatter = formatter;
+            if (size > internal::AsyncLogSlot::INLINE_CAPACITY) {
+                slot.heapPayload = new u8[size];
+                return slot.heapPayload;
+            }
+            return slot.inlinePayload;
+        }
+
+        PYRO_FORCEINLINE void Publish(internal::AsyncLogSlot& slot) {
+            // AcquireSlot claimed position sequence, publishing it is sequence + 1
+            slot.sequence.store(slot.sequence.load(eastl::memory_order_relaxed) + 1, eastl::memory_order_release);
+            // pairs with the fence in SinkThreadMain, either the sink thread sees the message or we see it waiting
+            eastl::atomic_thread_fence(eastl::memory_order_seq_cst);
+            if (mSinkThreadWaiting.load(eastl::memory_order_relaxed)) {
+                WakeSinkThread();
+            }
+        }
+
+        PYRO_COMMON_API void WakeSinkThread();
+        PYRO_COMMON_API void SinkThreadMain();
+        PYRO_COMMON_API u32 Drain();
+        PYRO_COMMON_API void Deliver(const internal::AsyncLogSlot& slot, const char* message, usize length);
+        PYRO_COMMON_API void Deliver(LogSeverity severity, const char* message, usize length);
+
+        internal::AsyncLogSlot* mSlots = nullptr;
+        u32 mMask = 0;
+        LogOverflowPolicy mPolicy;
+        LogSeverity mMinSeverity = LogSeverity::Fatal;
+        eastl::vector<ILogStream*> mSinks = {};
+
+        alignas(64) eastl::atomic<u64> mEnqueuePos = 0;
+        alignas(64) eastl::atomic<u64> mDelivered = 0;
+        u64 mDequeuePos = 0;
+        eastl::atomic<u64> mDropped = 0;
+        u64 mReportedDrops = 0;
+        // Deferred records are formatted into this on the sink thread
+        fmt::memory_buffer mFormatBuffer = {};
+
+        eastl::atomic<bool> mSinkThreadWaiting = false;
+        eastl::atomic<bool> mStopping = false;
+        std::mutex mMutex = {};
+        std::condition_variable mWake = {};
+        std::condition_variable mFlushed = {};
+        std::thread mSinkThread = {};
+    };
+} // namespace PyroshockStudios
+
+// PYRO_LOG for AsyncLogStream::LogDeferred, compiled out below PYRO_COMMON_MIN_LOG_SEVERITY
+#define PYRO_LOG_DEFERRED(severity, asyncStream, format, ...)                                                \
+    do {                                                                                                     \
+        if constexpr (::PyroshockStudios::Logger::IsCompiledIn(::PyroshockStudios::LogSeverity::severity)) { \
+            PYRO_LOG_DECLARE_SITE(pyroLogSite, severity, format);                                            \
+            (asyncStream)->LogDeferredAt(pyroLogSite, format __VA_OPT__(, ) __VA_ARGS__);                    \
+        }                                                                                                    \
+    } while (0)
\ No newline at end of file
@@ -0,0 +1,150 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/Logging/DeferredFormat.hpp>
+
+#include <string.h>
+
+// Layout of the files written by BinaryLogStream, all integers little-endian:
+//   header:  "PYROBLOG" | u32 version | u64 start time in nanoseconds since the Unix epoch
+//   records: u8 kind, then by kind
+//     Site     varint id | u8 severity | varint line | string file | string function | string format
+//     Message  varint time delta | varint site id | u8 severity | varint argument count | arguments
+//     Text     varint time delta | varint site id (0 if none) | u8 severity | string message
+//   strings are a varint length followed by the bytes, arguments are a BinaryLogArgType followed by the value.
+// Time deltas are nanoseconds since the previous record, or since the start time for the first one.
+// A Site record precedes the first record that refers to it.
+namespace PyroshockStudios {
+    enum class BinaryLogRecordKind : u8 {
+        Site = 1,
+        Message = 2,
+        Text = 3
+    };
+
+    enum class BinaryLogArgType : u8 {
+        // zigzag varint
+        Signed,
+        Unsigned,
+        // 8 bytes
+        Double,
+        Bool,
+        Char,
+        String,
+        // varint address, formats like a void*
+        Pointer
+    };
+
+    // Arguments a binary log record can hold
+    template <typename T>
+    concept BinaryLogArgConcept =
+        LogStringConcept<T> ||
+        eastl::is_arithmetic_v<eastl::decay_t<T>> ||
+        eastl::is_enum_v<eastl::decay_t<T>> ||
+        eastl::is_pointer_v<eastl::decay_t<T>>;
+
+    namespace internal {
+        constexpr char BINARY_LOG_MAGIC[8] = { 'P', 'Y', 'R', 'O', 'B', 'L', 'O', 'G' };
+        constexpr u32 BINARY_LOG_VERSION = 1;
+        constexpr usize BINARY_LOG_HEADER_SIZE = sizeof(BINARY_LOG_MAGIC) + sizeof(u32) + sizeof(u64);
+        constexpr usize MAX_VARINT_SIZE = 10;
+
+        template <typename T, bool IsEnum = eastl::is_enum_v<T>>
+        struct BinaryLogArgMapping {
+            using Type = eastl::conditional_t<eastl::is_same_v<T, bool> || eastl::is_same_v<T, char>, T,
+                eastl::conditional_t<eastl::is_floating_point_v<T>, double,
+                    eastl::conditional_t<eastl::is_pointer_v<T>, const void*,
+                        eastl::conditional_t<eastl::is_signed_v<T>, i64, u64>>>>;
+        };
+        template <typename T>
+        struct BinaryLogArgMapping<T, true> : BinaryLogArgMapping<eastl::underlying_type_t<T>> {};
+
+        // What the decoder formats an argument as, the format string is checked against these at compile time
+        template <typename T>
+        using BinaryLogArg = eastl::conditional_t<LogStringConcept<T>, fmt::string_view, typename BinaryLogArgMapping<eastl::decay_t<T>>::Type>;
+
+        PYRO_FORCEINLINE u8* EncodeVarint(u8* cursor, u64 value) {
+            while (value >= 0x80) {
+                *cursor++ = static_cast<u8>(value) | 0x80;
+                value >>= 7;
+            }
+            *cursor++ = static_cast<u8>(value);
+            return cursor;
+        }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE constexpr u64 ZigZagEncode(i64 value) {
+            return (static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63);
+        }
+        PYRO_NODISCARD PYRO_FORCEINLINE constexpr i64 ZigZagDecode(u64 value) {
+            return static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1);
+        }
+
+        PYRO_FORCEINLINE u8* EncodeBinaryLogString(u8* cursor, const char* data, usize length) {
+            cursor = EncodeVarint(cursor, length);
+            memcpy(cursor, data, length);
+            return cursor + length;
+        }
+
+        /// Upper bound of the bytes EncodeBinaryLogArg writes for `value`.
+        template <typename T>
+        PYRO_NODISCARD PYRO_FORCEINLINE usize BinaryLogArgMaxSize(const T& value) {
+            if constexpr (LogStringConcept<T>) {
+                return 1 + MAX_VARINT_SIZE + AsLogString(value).size();
+            } else {
+                return 1 + MAX_VARINT_SIZE;
+            }
+        }
+
+        template <BinaryLogArgConcept T>
+        PYRO_FORCEINLINE u8* EncodeBinaryLogArg(u8* cursor, const T& value) {
+            using Mapped = BinaryLogArg<T>;
+            if constexpr (LogStringConcept<T>) {
+                const fmt::string_view string = AsLogString(value);
+                *cursor++ = static_cast<u8>(BinaryLogArgType::String);
+                return EncodeBinaryLogString(cursor, string.data(), string.size());
+            } else if constexpr (eastl::is_same_v<Mapped, bool>) {
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Bool);
+                *cursor++ = value ? 1 : 0;
+                return cursor;
+            } else if constexpr (eastl::is_same_v<Mapped, char>) {
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Char);
+                *cursor++ = static_cast<u8>(value);
+                return cursor;
+            } else if constexpr (eastl::is_same_v<Mapped, double>) {
+                const double converted = static_cast<double>(value);
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Double);
+                memcpy(cursor, &converted, sizeof(converted));
+                return cursor + sizeof(converted);
+            } else if constexpr (eastl::is_same_v<Mapped, const void*>) {
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Pointer);
+                return EncodeVarint(cursor, reinterpret_cast<uptr>(value));
+            } else if constexpr (eastl::is_same_v<Mapped, i64>) {
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Signed);
+                return EncodeVarint(cursor, ZigZagEncode(static_cast<i64>(value)));
+            } else {
+                *cursor++ = static_cast<u8>(BinaryLogArgType::Unsigned);
+                return EncodeVarint(cursor, static_cast<u64>(value));
+            }
+        }
+    } // namespace internal
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,250 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BinaryLogReader.hpp"
+#include "BinaryLogFormat.hpp"
+
+#include <EASTL/algorithm.h>
+#include <fmt/args.h>
+#include <fmt/format.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        constexpr usize READ_CHUNK_SIZE = 64 * 1024;
+        // Sanity limit for corrupt files, no single string in a log is this long
+        constexpr u64 MAX_STRING_LENGTH = 64ull * 1024 * 1024;
+        constexpr u64 MAX_ARGUMENT_COUNT = 1024;
+    } // namespace
+
+    PYRO_COMMON_API BinaryLogReader::BinaryLogReader(IStreamReader& reader) : mReader(reader) {
+        u8 header[internal::BINARY_LOG_HEADER_SIZE];
+        if (!ReadBytes(header, sizeof(header)) || memcmp(header, internal::BINARY_LOG_MAGIC, sizeof(internal::BINARY_LOG_MAGIC)) != 0) {
+            return;
+        }
+        u32 version = 0;
+        memcpy(&version, header + sizeof(internal::BINARY_LOG_MAGIC), sizeof(version));
+        memcpy(&mStartTime, header + sizeof(internal::BINARY_LOG_MAGIC) + sizeof(u32), sizeof(mStartTime));
+        mLastTimestamp = mStartTime;
+        mValid = version == internal::BINARY_LOG_VERSION;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::Next(BinaryLogRecord& record) {
+        if (!mValid) {
+            return false;
+        }
+        for (;;) {
+            u8 kind = 0;
+            if (!ReadBytes(&kind, 1)) {
+                return false;
+            }
+            if (kind == static_cast<u8>(BinaryLogRecordKind::Site)) {
+                if (!ReadSite()) {
+                    return false;
+                }
+                continue;
+            }
+            if (kind != static_cast<u8>(BinaryLogRecordKind::Message) && kind != static_cast<u8>(BinaryLogRecordKind::Text)) {
+                return false;
+            }
+
+            u64 delta = 0;
+            u64 siteId = 0;
+            u8 severity = 0;
+            if (!ReadVarint(delta) || !ReadVarint(siteId) || !ReadBytes(&severity, 1)) {
+                return false;
+            }
+            if (siteId >= mSites.size() || (siteId != 0 && !mSites[siteId]) || severity > static_cast<u8>(LogSeverity::Fatal)) {
+                return false;
+            }
+            mLastTimestamp += delta;
+            record.timestamp = mLastTimestamp;
+            record.severity = static_cast<LogSeverity>(severity);
+            record.site = siteId != 0 ? mSites[siteId].get() : nullptr;
+
+            if (kind == static_cast<u8>(BinaryLogRecordKind::Text)) {
+                return ReadString(record.message);
+            }
+            return record.site && ReadArguments(*record.site, record.message);
+        }
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::Fill(usize bytes) {
+        if (mEnd - mPosition >= bytes) {
+            return true;
+        }
+        // keep the unread tail and append to it
+        if (mPosition != 0) {
+            memmove(mBuffer.data(), mBuffer.data() + mPosition, mEnd - mPosition);
+            mEnd -= mPosition;
+            mPosition = 0;
+        }
+        if (mBuffer.size() < eastl::max(bytes, READ_CHUNK_SIZE)) {
+            mBuffer.resize(eastl::max(bytes, READ_CHUNK_SIZE));
+        }
+        while (mEnd < bytes) {
+            const usize read = mReader.Read(mBuffer.data() + mEnd, mBuffer.size() - mEnd);
+            if (read == 0) {
+                return false;
+            }
+            mEnd += read;
+        }
+        return true;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::ReadBytes(void* out, usize size) {
+        if (!Fill(size)) {
+            return false;
+        }
+        memcpy(out, mBuffer.data() + mPosition, size);
+        mPosition += size;
+        return true;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::ReadVarint(u64& value) {
+        value = 0;
+        for (u32 shift = 0; shift < 64; shift += 7) {
+            u8 byte = 0;
+            if (!ReadBytes(&byte, 1)) {
+                return false;
+            }
+            value |= static_cast<u64>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::ReadString(eastl::string& out) {
+        u64 length = 0;
+        if (!ReadVarint(length) || length > MAX_STRING_LENGTH || !Fill(static_cast<usize>(length))) {
+            return false;
+        }
+        out.assign(reinterpret_cast<const char*>(mBuffer.data() + mPosition), static_cast<usize>(length));
+        mPosition += static_cast<usize>(length);
+        return true;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::ReadSite() {
+        auto site = eastl::make_unique<BinaryLogSite>();
+        u64 id = 0;
+        u8 severity = 0;
+        u64 line = 0;
+        if (!ReadVarint(id) || !ReadBytes(&severity, 1) || !ReadVarint(line) ||
+            !ReadString(site->file) || !ReadString(site->function) || !ReadString(site->format)) {
+            return false;
+        }
+        // ids are handed out in order, anything far ahead is corruption
+        if (id == 0 || id > mSites.size() + 1024 || severity > static_cast<u8>(LogSeverity::Fatal)) {
+            return false;
+        }
+        site->id = static_cast<u32>(id);
+        site->severity = static_cast<LogSeverity>(severity);
+        site->line = static_cast<u32>(line);
+        if (mSites.size() <= id) {
+            mSites.resize(id + 1);
+        }
+        mSites[id] = eastl::move(site);
+        return true;
+    }
+
+    PYRO_COMMON_API bool BinaryLogReader::ReadArguments(const BinaryLogSite& site, eastl::string& message) {
+        u64 count = 0;
+        if (!ReadVarint(count) || count > MAX_ARGUMENT_COUNT) {
+            return false;
+        }
+        // the store keeps views of the strings, they must not move until the message is formatted
+        mStringArgs.clear();
+        mStringArgs.reserve(static_cast<usize>(count));
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        for (u64 i = 0; i < count; ++i) {
+            u8 type = 0;
+            if (!ReadBytes(&type, 1)) {
+                return false;
+            }
+            u64 value = 0;
+            switch (static_cast<BinaryLogArgType>(type)) {
+            case BinaryLogArgType::Signed:
+                if (!ReadVarint(value)) {
+                    return false;
+                }
+                store.push_back(internal::ZigZagDecode(value));
+                break;
+            case BinaryLogArgType::Unsigned:
+                if (!ReadVarint(value)) {
+                    return false;
+                }
+                store.push_back(value);
+                break;
+            case BinaryLogArgType::Double: {
+                double number = 0.0;
+                if (!ReadBytes(&number, sizeof(number))) {
+                    return false;
+                }
+                store.push_back(number);
+                break;
+            }
+            case BinaryLogArgType::Bool:
+            case BinaryLogArgType::Char: {
+                u8 byte = 0;
+                if (!ReadBytes(&byte, 1)) {
+                    return false;
+                }
+                if (static_cast<BinaryLogArgType>(type) == BinaryLogArgType::Bool) {
+                    store.push_back(byte != 0);
+                } else {
+                    store.push_back(static_cast<char>(byte));
+                }
+                break;
+            }
+            case BinaryLogArgType::String: {
+                eastl::string& string = mStringArgs.emplace_back();
+                if (!ReadString(string)) {
+                    return false;
+                }
+                store.push_back(fmt::string_view(string.data(), string.size()));
+                break;
+            }
+            case BinaryLogArgType::Pointer:
+                if (!ReadVarint(value)) {
+                    return false;
+                }
+                store.push_back(reinterpret_cast<const void*>(static_cast<uptr>(value)));
+                break;
+            default:
+                return false;
+            }
+        }
+
+        fmt::memory_buffer buffer;
+        try {
+            fmt::vformat_to(fmt::appender(buffer), fmt::string_view(site.format.data(), site.format.size()), store);
+        } catch (const fmt::format_error& error) {
+            // written by a different build whose format doesn't match the arguments, keep the raw format
+            buffer.clear();
+            fmt::format_to(fmt::appender(buffer), "{} <format error: {}>", fmt::string_view(site.format.data(), site.format.size()), error.what());
+        }
+        message.assign(buffer.data(), buffer.size());
+        return true;
+    }
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Stream/IStreamReader.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    // Call site of a binary log, as stored in the file
+    struct BinaryLogSite {
+        u32 id = 0;
+        LogSeverity severity = LogSeverity::Verbose;
+        u32 line = 0;
+        eastl::string file = {};
+        eastl::string function = {};
+        eastl::string format = {};
+    };
+
+    struct BinaryLogRecord {
+        // Nanoseconds since the Unix epoch
+        u64 timestamp = 0;
+        LogSeverity severity = LogSeverity::Verbose;
+        // Owned by the reader, null for text messages logged without a call site
+        const BinaryLogSite* site = nullptr;
+        // Formatted message
+        eastl::string message = {};
+    };
+
+    // Reads files written by BinaryLogStream and formats their records back into text.
+    class BinaryLogReader : DeleteCopy {
+    public:
+        /// Reads from `reader`, which must outlive the BinaryLogReader.
+        PYRO_COMMON_API explicit BinaryLogReader(IStreamReader& reader);
+
+        /// False if the stream doesn't start with a binary log header.
+        PYRO_NODISCARD bool IsValid() const noexcept { return mValid; }
+        /// Nanoseconds since the Unix epoch when the log was created.
+        PYRO_NODISCARD u64 StartTime() const noexcept { return mStartTime; }
+
+        /// Reads the next message, returns false at the end of the log or at a truncated or corrupt record.
+        PYRO_NODISCARD PYRO_COMMON_API bool Next(BinaryLogRecord& record);
+
+    private:
+        PYRO_NODISCARD PYRO_COMMON_API bool Fill(usize bytes);
+        PYRO_NODISCARD PYRO_COMMON_API bool ReadBytes(void* out, usize size);
+        PYRO_NODISCARD PYRO_COMMON_API bool ReadVarint(u64& value);
+        PYRO_NODISCARD PYRO_COMMON_API bool ReadString(eastl::string& out);
+        PYRO_NODISCARD PYRO_COMMON_API bool ReadSite();
+        PYRO_NODISCARD PYRO_COMMON_API bool ReadArguments(const BinaryLogSite& site, eastl::string& message);
+
+        IStreamReader& mReader;
+        eastl::vector<u8> mBuffer = {};
+        usize mPosition = 0;
+        usize mEnd = 0;
+        bool mValid = false;
+        u64 mStartTime = 0;
+        u64 mLastTimestamp = 0;
+        // indexed by site id, ids start at 1
+        eastl::vector<eastl::unique_ptr<BinaryLogSite>> mSites = {};
+        eastl::vector<eastl::string> mStringArgs = {};
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
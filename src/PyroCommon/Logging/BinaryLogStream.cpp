@@ -0,0 +1,149 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BinaryLogStream.hpp"
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <chrono>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        u64 NowNanoseconds() {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                    .count());
+        }
+    } // namespace
+
+    PYRO_COMMON_API BinaryLogStream::BinaryLogStream(const eastl::string& path, LogSeverity minSeverity, usize bufferSize)
+        : mFile(eastl::make_unique<FileStream>(path, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly)),
+          mWriter(mFile.get()), mMinSeverity(minSeverity), mFlushThreshold(bufferSize) {
+        WriteHeader();
+    }
+
+    PYRO_COMMON_API BinaryLogStream::BinaryLogStream(IStreamWriter& writer, LogSeverity minSeverity, usize bufferSize)
+        : mWriter(&writer), mMinSeverity(minSeverity), mFlushThreshold(bufferSize) {
+        WriteHeader();
+    }
+
+    PYRO_COMMON_API BinaryLogStream::~BinaryLogStream() {
+        LogSuppression::RemoveStream(this);
+        Flush();
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        if (severity < mMinSeverity) {
+            return;
+        }
+        std::lock_guard lock(mMutex);
+        u8* cursor = BeginRecord(BinaryLogRecordKind::Text, nullptr, severity, internal::MAX_VARINT_SIZE + length);
+        EndRecord(internal::EncodeBinaryLogString(cursor, message, length), severity);
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::Log(const LogSite& site, const char* message, usize length) {
+        if (site.severity < mMinSeverity) {
+            return;
+        }
+        std::lock_guard lock(mMutex);
+        u8* cursor = BeginRecord(BinaryLogRecordKind::Text, &site, site.severity, internal::MAX_VARINT_SIZE + length);
+        EndRecord(internal::EncodeBinaryLogString(cursor, message, length), site.severity);
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::Flush() {
+        LogSuppression::FlushPending(this);
+        std::lock_guard lock(mMutex);
+        FlushLocked();
+    }
+
+    PYRO_COMMON_API u8* BinaryLogStream::BeginRecord(BinaryLogRecordKind kind, const LogSite* site, LogSeverity severity, usize maxPayload) {
+        u32 siteId = 0;
+        if (site) {
+            auto [it, inserted] = mSiteIds.insert(eastl::make_pair(site, static_cast<u32>(mSiteIds.size() + 1)));
+            siteId = it->second;
+            if (inserted) {
+                const usize fileLength = strlen(site->file);
+                const usize functionLength = strlen(site->function);
+                const usize formatLength = strlen(site->format);
+                u8* cursor = Reserve(2 + 5 * internal::MAX_VARINT_SIZE + fileLength + functionLength + formatLength);
+                *cursor++ = static_cast<u8>(BinaryLogRecordKind::Site);
+                cursor = internal::EncodeVarint(cursor, siteId);
+                *cursor++ = static_cast<u8>(site->severity);
+                cursor = internal::EncodeVarint(cursor, site->line);
+                cursor = internal::EncodeBinaryLogString(cursor, site->file, fileLength);
+                cursor = internal::EncodeBinaryLogString(cursor, site->function, functionLength);
+                cursor = internal::EncodeBinaryLogString(cursor, site->format, formatLength);
+                mBufferUsed = cursor - mBuffer.data();
+            }
+        }
+
+        // the clock can go backwards, records keep their order and get a zero delta
+        const u64 now = eastl::max(NowNanoseconds(), mLastTimestamp);
+        const u64 delta = now - mLastTimestamp;
+        mLastTimestamp = now;
+
+        u8* cursor = Reserve(2 + 2 * internal::MAX_VARINT_SIZE + maxPayload);
+        *cursor++ = static_cast<u8>(kind);
+        cursor = internal::EncodeVarint(cursor, delta);
+        cursor = internal::EncodeVarint(cursor, siteId);
+        *cursor++ = static_cast<u8>(severity);
+        return cursor;
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::EndRecord(u8* cursor, LogSeverity severity) {
+        mBufferUsed = cursor - mBuffer.data();
+        if (mBufferUsed >= mFlushThreshold || severity >= LogSeverity::Error) {
+            FlushLocked();
+        }
+    }
+
+    PYRO_COMMON_API u8* BinaryLogStream::Reserve(usize bytes) {
+        if (mBufferUsed + bytes > mBuffer.size()) {
+            mBuffer.resize(eastl::max(mBufferUsed + bytes, mFlushThreshold + mFlushThreshold / 2));
+        }
+        return mBuffer.data() + mBufferUsed;
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::WriteHeader() {
+        mLastTimestamp = NowNanoseconds();
+        u8* cursor = Reserve(internal::BINARY_LOG_HEADER_SIZE);
+        memcpy(cursor, internal::BINARY_LOG_MAGIC, sizeof(internal::BINARY_LOG_MAGIC));
+        memcpy(cursor + sizeof(internal::BINARY_LOG_MAGIC), &internal::BINARY_LOG_VERSION, sizeof(u32));
+        memcpy(cursor + sizeof(internal::BINARY_LOG_MAGIC) + sizeof(u32), &mLastTimestamp, sizeof(u64));
+        mBufferUsed += internal::BINARY_LOG_HEADER_SIZE;
+    }
+
+    PYRO_COMMON_API void BinaryLogStream::FlushLocked() {
+        if (mBufferUsed == 0) {
+            return;
+        }
+        if (mWriter->Write(mBuffer.data(), mBufferUsed) != mBufferUsed) {
+            mFailed = true;
+        }
+        mBufferUsed = 0;
+    }
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,110 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Logging/BinaryLogFormat.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <mutex>
+
+namespace PyroshockStudios {
+    // ILogStream that writes compact binary records (see BinaryLogFormat.hpp) instead of text.
+    // LogBinary/PYRO_LOG_BINARY store the raw arguments and an interned id of the call site, the format string
+    // is written once per site. Text messages from other entry points are stored as they are.
+    // Records are buffered and written in blocks, Error and Fatal messages flush immediately.
+    // Files are turned back into text with BinaryLogReader or the PyroLogDecoder tool.
+    class BinaryLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        static constexpr usize DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        /// Creates or truncates the file at `path`.
+        PYRO_COMMON_API explicit BinaryLogStream(const eastl::string& path, LogSeverity minSeverity = LogSeverity::Verbose,
+            usize bufferSize = DEFAULT_BUFFER_SIZE);
+        /// Writes to `writer`, which must outlive the stream.
+        PYRO_COMMON_API explicit BinaryLogStream(IStreamWriter& writer, LogSeverity minSeverity = LogSeverity::Verbose,
+            usize bufferSize = DEFAULT_BUFFER_SIZE);
+        PYRO_COMMON_API ~BinaryLogStream();
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_COMMON_API void Log(const LogSite& site, const char* message, usize length) override;
+        PYRO_NODISCARD LogSeverity MinSeverity() const override { return mMinSeverity; }
+        PYRO_NODISCARD const char* Name() const override { return "BinaryLogStream"; }
+
+        /// Records the arguments without formatting them. `site` must have static storage duration.
+        template <BinaryLogArgConcept... Args>
+        void LogBinary(const LogSite& site, fmt::format_string<internal::BinaryLogArg<Args>...> format, const Args&... args) {
+            (void)format;
+            if (site.severity < mMinSeverity) {
+                return;
+            }
+            const usize maxSize = internal::MAX_VARINT_SIZE + (usize(0) + ... + internal::BinaryLogArgMaxSize(args));
+            std::lock_guard lock(mMutex);
+            u8* cursor = BeginRecord(BinaryLogRecordKind::Message, &site, site.severity, maxSize);
+            cursor = internal::EncodeVarint(cursor, sizeof...(Args));
+            ((cursor = internal::EncodeBinaryLogArg(cursor, args)), ...);
+            EndRecord(cursor, site.severity);
+        }
+
+        /// Writes the buffered records to the underlying stream.
+        PYRO_COMMON_API void Flush();
+
+        /// False once a write to the underlying stream came up short, records may have been lost.
+        PYRO_NODISCARD bool IsGood() const noexcept { return !mFailed; }
+
+    private:
+        // Both called with mMutex held. BeginRecord writes the record header and reserves `maxPayload` more bytes.
+        PYRO_NODISCARD PYRO_COMMON_API u8* BeginRecord(BinaryLogRecordKind kind, const LogSite* site, LogSeverity severity, usize maxPayload);
+        PYRO_COMMON_API void EndRecord(u8* cursor, LogSeverity severity);
+        PYRO_NODISCARD PYRO_COMMON_API u8* Reserve(usize bytes);
+        PYRO_COMMON_API void WriteHeader();
+        PYRO_COMMON_API void FlushLocked();
+
+        eastl::unique_ptr<FileStream> mFile = {};
+        IStreamWriter* mWriter = nullptr;
+        LogSeverity mMinSeverity;
+        usize mFlushThreshold;
+        bool mFailed = false;
+
+        std::mutex mMutex = {};
+        eastl::vector<u8> mBuffer = {};
+        usize mBufferUsed = 0;
+        u64 mLastTimestamp = 0;
+        eastl::unordered_map<const LogSite*, u32> mSiteIds = {};
+    };
+} // namespace PyroshockStudios
+
+// PYRO_LOG for BinaryLogStream::LogBinary, compiled out below PYRO_COMMON_MIN_LOG_SEVERITY
+#define PYRO_LOG_BINARY(severity, binaryStream, format, ...)                                                 \
+    do {                                                                                                     \
+        if constexpr (::PyroshockStudios::Logger::IsCompiledIn(::PyroshockStudios::LogSeverity::severity)) { \
+            PYRO_LOG_DECLARE_SITE(pyroLogSite, severity, format);                                            \
+            (binaryStream)->LogBinary(pyroLogSite, format __VA_OPT__(, ) __VA_ARGS__);                       \
+        }                                                                                                    \
+    } while (0)
\ No newline at end of file
@@ -0,0 +1,140 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Concepts.hpp>
+#include <PyroCommon/Core.hpp>
+
+#include <fmt/format.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    // Arguments that are copied as text when a log call is captured for formatting later
+    template <typename T>
+    concept LogStringConcept =
+        eastl::is_same_v<eastl::decay_t<T>, const char*> ||
+        eastl::is_same_v<eastl::decay_t<T>, char*> ||
+        requires(const T& t) {
+            { t.data() } -> ConvertibleTo<const char*>;
+            { t.length() } -> ConvertibleTo<usize>;
+        };
+
+    // Arguments a deferred log call can capture: strings, or values that can be copied byte by byte
+    template <typename T>
+    concept DeferredLogArgConcept =
+        LogStringConcept<T> ||
+        (eastl::is_trivially_copyable_v<eastl::decay_t<T>> && eastl::is_default_constructible_v<eastl::decay_t<T>>);
+
+    namespace internal {
+        // What a captured argument is formatted as, strings come back as views into the captured bytes
+        template <typename T>
+        using DeferredLogArg = eastl::conditional_t<LogStringConcept<T>, fmt::string_view, eastl::decay_t<T>>;
+
+        // Formats a payload written by EncodeDeferredLog. Each instantiation of FormatDeferredLog is one of these,
+        // so the pointer is all the static metadata a record needs to be decoded.
+        using DeferredLogFormatter = void (*)(fmt::memory_buffer& out, const u8* payload);
+
+        template <typename... Args>
+        struct DeferredLogTypes {};
+
+        template <LogStringConcept T>
+        PYRO_NODISCARD PYRO_FORCEINLINE fmt::string_view AsLogString(const T& value) {
+            if constexpr (eastl::is_pointer_v<eastl::decay_t<T>>) {
+                const char* string = value;
+                return string ? fmt::string_view(string) : fmt::string_view("(null)");
+            } else {
+                return fmt::string_view(value.data(), value.length());
+            }
+        }
+
+        template <typename T>
+        PYRO_NODISCARD PYRO_FORCEINLINE usize DeferredLogArgSize(const T& value) {
+            if constexpr (LogStringConcept<T>) {
+                return sizeof(u32) + AsLogString(value).size();
+            } else {
+                return sizeof(eastl::decay_t<T>);
+            }
+        }
+
+        template <typename T>
+        PYRO_FORCEINLINE u8* EncodeDeferredLogArg(u8* cursor, const T& value) {
+            if constexpr (LogStringConcept<T>) {
+                const fmt::string_view string = AsLogString(value);
+                const u32 length = static_cast<u32>(string.size());
+                memcpy(cursor, &length, sizeof(length));
+                memcpy(cursor + sizeof(length), string.data(), length);
+                return cursor + sizeof(length) + length;
+            } else {
+                memcpy(cursor, &value, sizeof(eastl::decay_t<T>));
+                return cursor + sizeof(eastl::decay_t<T>);
+            }
+        }
+
+        template <typename T>
+        PYRO_NODISCARD PYRO_FORCEINLINE DeferredLogArg<T> DecodeDeferredLogArg(const u8*& cursor) {
+            if constexpr (LogStringConcept<T>) {
+                u32 length = 0;
+                memcpy(&length, cursor, sizeof(length));
+                const char* data = reinterpret_cast<const char*>(cursor + sizeof(length));
+                cursor += sizeof(length) + length;
+                return fmt::string_view(data, length);
+            } else {
+                eastl::decay_t<T> value;
+                memcpy(&value, cursor, sizeof(value));
+                cursor += sizeof(value);
+                return value;
+            }
+        }
+
+        /// Bytes EncodeDeferredLog writes for the format string and `args`.
+        template <typename... Args>
+        PYRO_NODISCARD PYRO_FORCEINLINE usize DeferredLogSize(const Args&... args) {
+            return (sizeof(fmt::string_view) + ... + DeferredLogArgSize(args));
+        }
+
+        /// Captures the format string and `args`. The format string is stored by address and must be a literal.
+        template <typename... Args>
+        PYRO_FORCEINLINE void EncodeDeferredLog(u8* cursor, fmt::string_view format, const Args&... args) {
+            memcpy(cursor, &format, sizeof(format));
+            cursor += sizeof(format);
+            ((cursor = EncodeDeferredLogArg(cursor, args)), ...);
+        }
+
+        template <typename... Decoded>
+        void FormatDeferredLogArgs(fmt::memory_buffer& out, fmt::string_view format, const u8*, DeferredLogTypes<>, Decoded&... decoded) {
+            fmt::vformat_to(fmt::appender(out), format, fmt::make_format_args(decoded...));
+        }
+
+        template <typename First, typename... Rest, typename... Decoded>
+        void FormatDeferredLogArgs(fmt::memory_buffer& out, fmt::string_view format, const u8* cursor, DeferredLogTypes<First, Rest...>, Decoded&... decoded) {
+            DeferredLogArg<First> value = DecodeDeferredLogArg<First>(cursor);
+            FormatDeferredLogArgs(out, format, cursor, DeferredLogTypes<Rest...>{}, decoded..., value);
+        }
+
+        template <typename... Args>
+        void FormatDeferredLog(fmt::memory_buffer& out, const u8* payload) {
+            fmt::string_view format;
+            memcpy(&format, payload, sizeof(format));
+            FormatDeferredLogArgs(out, format, payload + sizeof(format), DeferredLogTypes<Args...>{});
+        }
+    } // namespace internal
+} // namespace PyroshockStudios
\ No newline at end of file
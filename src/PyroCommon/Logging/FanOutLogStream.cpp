@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "FanOutLogStream.hpp"
+
+#include <EASTL/algorithm.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    PYRO_COMMON_API FanOutLogStream::FanOutLogStream(eastl::span<const FanOutLogSink> sinks) : mSinks(sinks.size()) {
+        for (usize i = 0; i < sinks.size(); ++i) {
+            mSinks[i].stream = sinks[i].stream;
+            mSinks[i].minSeverity.store(static_cast<u32>(sinks[i].minSeverity), eastl::memory_order_relaxed);
+        }
+        Refresh();
+    }
+
+    PYRO_COMMON_API void FanOutLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void FanOutLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        for (const Sink& sink : mSinks) {
+            if (static_cast<u32>(severity) >= sink.effectiveSeverity.load(eastl::memory_order_relaxed)) {
+                sink.stream->Log(severity, message, length);
+            }
+        }
+    }
+
+    PYRO_COMMON_API void FanOutLogStream::Log(const LogSite& site, const char* message, usize length) {
+        for (const Sink& sink : mSinks) {
+            if (static_cast<u32>(site.severity) >= sink.effectiveSeverity.load(eastl::memory_order_relaxed)) {
+                sink.stream->Log(site, message, length);
+            }
+        }
+    }
+
+    PYRO_COMMON_API void FanOutLogStream::SetMinSeverity(usize index, LogSeverity severity) {
+        mSinks[index].minSeverity.store(static_cast<u32>(severity), eastl::memory_order_relaxed);
+        Refresh();
+    }
+
+    PYRO_COMMON_API void FanOutLogStream::Refresh() {
+        u32 lowest = static_cast<u32>(LogSeverity::Fatal);
+        for (Sink& sink : mSinks) {
+            const u32 severity = eastl::max(sink.minSeverity.load(eastl::memory_order_relaxed), static_cast<u32>(sink.stream->MinSeverity()));
+            sink.effectiveSeverity.store(severity, eastl::memory_order_relaxed);
+            lowest = eastl::min(lowest, severity);
+        }
+        mMinSeverity.store(lowest, eastl::memory_order_relaxed);
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,70 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    struct FanOutLogSink {
+        ILogStream* stream;
+        // Raised to the MinSeverity() of the stream if that is higher
+        LogSeverity minSeverity = LogSeverity::Verbose;
+    };
+
+    // ILogStream that hands every message to several sinks, each with its own minimum severity.
+    // The effective severity of each sink is cached, a message costs one virtual call per sink that takes it.
+    // The sinks are called on the logging thread and must outlive the stream.
+    class FanOutLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        PYRO_COMMON_API explicit FanOutLogStream(eastl::span<const FanOutLogSink> sinks);
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_COMMON_API void Log(const LogSite& site, const char* message, usize length) override;
+        /// The lowest severity any sink takes.
+        PYRO_NODISCARD LogSeverity MinSeverity() const override {
+            return static_cast<LogSeverity>(mMinSeverity.load(eastl::memory_order_relaxed));
+        }
+        PYRO_NODISCARD const char* Name() const override { return "FanOutLogStream"; }
+
+        PYRO_NODISCARD usize SinkCount() const noexcept { return mSinks.size(); }
+        /// Changes the severity of the sink at `index`, the order is the one passed to the constructor.
+        PYRO_COMMON_API void SetMinSeverity(usize index, LogSeverity severity);
+        /// Re-reads MinSeverity() of the sinks, for sinks whose severity changed after construction.
+        PYRO_COMMON_API void Refresh();
+
+    private:
+        struct Sink {
+            ILogStream* stream = nullptr;
+            eastl::atomic<u32> minSeverity = 0;
+            eastl::atomic<u32> effectiveSeverity = 0;
+        };
+
+        eastl::vector<Sink> mSinks;
+        eastl::atomic<u32> mMinSeverity = static_cast<u32>(LogSeverity::Fatal);
+    };
+} // namespace PyroshockStudios
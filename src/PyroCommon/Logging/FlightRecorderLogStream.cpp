@@ -0,0 +1,181 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "FlightRecorderLogStream.hpp"
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <chrono>
+#include <new>
+#include <string.h>
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#error "Missing FlightRecorderLogStream.cpp implementation for this platform!"
+#endif
+
+namespace PyroshockStudios {
+    namespace {
+        u64 NowNanoseconds() {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        // small ids in order of the first message of each thread, cheaper than asking the OS every time
+        u32 CurrentThreadIndex() {
+            static eastl::atomic<u32> gNextThreadIndex = 0;
+            thread_local u32 tThreadIndex = gNextThreadIndex.fetch_add(1, eastl::memory_order_relaxed);
+            return tThreadIndex;
+        }
+    } // namespace
+
+    PYRO_COMMON_API FlightRecorderLogStream::FlightRecorderLogStream(const eastl::string& path, LogSeverity minSeverity,
+        u32 recordCount, u32 recordSize)
+        : mMinSeverity(minSeverity) {
+        mRecordSize = static_cast<u32>(PYRO_ALIGN(eastl::max<usize>(recordSize, 2 * sizeof(internal::FlightRecorderRecordHeader)), 64));
+        mRecordCount = eastl::max(recordCount, 1u);
+        const usize size = sizeof(internal::FlightRecorderFileHeader) + static_cast<usize>(mRecordSize) * mRecordCount;
+
+        void* mapping = nullptr;
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        mFileHandle = file;
+        mMappingHandle = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<u64>(size) >> 32),
+            static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+        if (!mMappingHandle) {
+            return;
+        }
+        mapping = MapViewOfFile(mMappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        mFd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (mFd < 0) {
+            return;
+        }
+        bool allocated = false;
+#if defined(PYRO_PLATFORM_LINUX)
+        // allocates the blocks now, a store into a hole of a full disk would raise SIGBUS
+        allocated = posix_fallocate(mFd, 0, static_cast<off_t>(size)) == 0;
+#endif
+        if (!allocated && ftruncate(mFd, static_cast<off_t>(size)) != 0) {
+            return;
+        }
+        mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+        if (mapping == MAP_FAILED) {
+            return;
+        }
+#endif
+        if (!mapping) {
+            return;
+        }
+        mMappedSize = size;
+        mRecords = static_cast<u8*>(mapping) + sizeof(internal::FlightRecorderFileHeader);
+        // touches every page up front, so logging doesn't take the page faults
+        for (u32 i = 0; i < mRecordCount; ++i) {
+            new (mRecords + static_cast<usize>(i) * mRecordSize) internal::FlightRecorderRecordHeader{};
+        }
+
+        internal::FlightRecorderFileHeader* header = new (mapping) internal::FlightRecorderFileHeader{};
+        memcpy(header->magic, internal::FLIGHT_RECORDER_MAGIC, sizeof(internal::FLIGHT_RECORDER_MAGIC));
+        header->version = internal::FLIGHT_RECORDER_VERSION;
+        header->headerSize = sizeof(internal::FlightRecorderFileHeader);
+        header->recordSize = mRecordSize;
+        header->recordCount = mRecordCount;
+        header->startTime = NowNanoseconds();
+        header->nextSequence.store(0, eastl::memory_order_release);
+        mHeader = header;
+    }
+
+    PYRO_COMMON_API FlightRecorderLogStream::~FlightRecorderLogStream() {
+        LogSuppression::RemoveStream(this);
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        if (mHeader) {
+            UnmapViewOfFile(mHeader);
+        }
+        if (mMappingHandle) {
+            CloseHandle(mMappingHandle);
+        }
+        if (mFileHandle) {
+            CloseHandle(mFileHandle);
+        }
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        if (mHeader) {
+            munmap(mHeader, mMappedSize);
+        }
+        if (mFd >= 0) {
+            close(mFd);
+        }
+#endif
+    }
+
+    PYRO_COMMON_API void FlightRecorderLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void FlightRecorderLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        if (severity < mMinSeverity || !mHeader) {
+            return;
+        }
+        const u64 sequence = mHeader->nextSequence.fetch_add(1, eastl::memory_order_relaxed);
+        u8* slot = mRecords + static_cast<usize>(sequence % mRecordCount) * mRecordSize;
+        auto* record = reinterpret_cast<internal::FlightRecorderRecordHeader*>(slot);
+
+        // claims the record, a writer a whole lap behind may still be filling it in
+        u64 previous = record->sequence.load(eastl::memory_order_relaxed);
+        if (previous == internal::FLIGHT_RECORDER_BUSY ||
+            !record->sequence.compare_exchange_strong(previous, internal::FLIGHT_RECORDER_BUSY, eastl::memory_order_acquire)) {
+            mDropped.fetch_add(1, eastl::memory_order_relaxed);
+            return;
+        }
+        const usize capacity = mRecordSize - sizeof(internal::FlightRecorderRecordHeader);
+        const usize stored = eastl::min(length, capacity);
+        record->timestamp = NowNanoseconds();
+        record->severity = static_cast<u32>(severity);
+        record->thread = CurrentThreadIndex();
+        record->length = static_cast<u32>(stored);
+        memcpy(slot + sizeof(internal::FlightRecorderRecordHeader), message, stored);
+        record->sequence.store(sequence + 1, eastl::memory_order_release);
+    }
+
+    PYRO_COMMON_API void FlightRecorderLogStream::Flush() {
+        LogSuppression::FlushPending(this);
+        if (!mHeader) {
+            return;
+        }
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        FlushViewOfFile(mHeader, mMappedSize);
+        FlushFileBuffers(mFileHandle);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        msync(mHeader, mMappedSize, MS_SYNC);
+#endif
+    }
+} // namespace PyroshockStudios
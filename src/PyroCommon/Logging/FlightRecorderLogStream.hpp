@@ -0,0 +1,110 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/string.h>
+
+namespace PyroshockStudios {
+    namespace internal {
+        // File layout: a FlightRecorderFileHeader followed by `recordCount` records of `recordSize` bytes each.
+        // A record is a FlightRecorderRecordHeader followed by up to `recordSize - sizeof(header)` bytes of text.
+        // The sequence of a record is 0 while it is empty or being written, and 1 + its index in the log once committed.
+        constexpr char FLIGHT_RECORDER_MAGIC[8] = { 'P', 'Y', 'R', 'O', 'F', 'R', 'E', 'C' };
+        constexpr u32 FLIGHT_RECORDER_VERSION = 1;
+        constexpr u64 FLIGHT_RECORDER_BUSY = ~0ull;
+
+        struct FlightRecorderFileHeader {
+            char magic[8];
+            u32 version;
+            u32 headerSize;
+            u32 recordSize;
+            u32 recordCount;
+            // Nanoseconds since the Unix epoch when the recorder was opened
+            u64 startTime;
+            eastl::atomic<u64> nextSequence;
+            u8 reserved[24];
+        };
+
+        struct FlightRecorderRecordHeader {
+            eastl::atomic<u64> sequence;
+            // Nanoseconds since the Unix epoch
+            u64 timestamp;
+            u32 severity;
+            u32 thread;
+            u32 length;
+            u32 reserved;
+        };
+
+        static_assert(sizeof(eastl::atomic<u64>) == sizeof(u64));
+        static_assert(sizeof(FlightRecorderFileHeader) == 64);
+        static_assert(sizeof(FlightRecorderRecordHeader) == 32);
+    } // namespace internal
+
+    // ILogStream that keeps the most recent messages in a ring of fixed-size records inside a memory-mapped file.
+    // Logging is a few memory stores with no lock and no syscall, so it can stay enabled at Verbose all the time.
+    // The pages belong to the file, so the ring survives a crash of the process and can be read back with
+    // FlightRecorderReader or the PyroFlightRecorderDump tool. Opening the file again starts a new ring.
+    // Messages longer than a record are truncated.
+    class FlightRecorderLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        static constexpr u32 DEFAULT_RECORD_COUNT = 16 * 1024;
+        static constexpr u32 DEFAULT_RECORD_SIZE = 256;
+
+        /// Creates or overwrites the file at `path`. `recordSize` is rounded up to a multiple of 64.
+        PYRO_COMMON_API explicit FlightRecorderLogStream(const eastl::string& path, LogSeverity minSeverity = LogSeverity::Verbose,
+            u32 recordCount = DEFAULT_RECORD_COUNT, u32 recordSize = DEFAULT_RECORD_SIZE);
+        PYRO_COMMON_API ~FlightRecorderLogStream();
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_NODISCARD LogSeverity MinSeverity() const override { return mMinSeverity; }
+        PYRO_NODISCARD const char* Name() const override { return "FlightRecorderLogStream"; }
+
+        /// Asks the OS to write the ring to disk, only needed to survive a crash of the machine rather than the process.
+        PYRO_COMMON_API void Flush();
+
+        /// False if the file couldn't be created or mapped, messages are dropped then.
+        PYRO_NODISCARD bool IsGood() const noexcept { return mHeader != nullptr; }
+        /// Messages dropped because another thread was still writing the record they would have replaced.
+        PYRO_NODISCARD u64 DroppedCount() const noexcept { return mDropped.load(eastl::memory_order_relaxed); }
+
+    private:
+        internal::FlightRecorderFileHeader* mHeader = nullptr;
+        u8* mRecords = nullptr;
+        usize mMappedSize = 0;
+        u32 mRecordSize = 0;
+        u32 mRecordCount = 0;
+        LogSeverity mMinSeverity;
+        eastl::atomic<u64> mDropped = 0;
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        void* mFileHandle = nullptr;
+        void* mMappingHandle = nullptr;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        int mFd = -1;
+#endif
+    };
+} // namespace PyroshockStudios
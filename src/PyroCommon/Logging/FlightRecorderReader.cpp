@@ -0,0 +1,87 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "FlightRecorderReader.hpp"
+#include "FlightRecorderLogStream.hpp"
+
+#include <EASTL/sort.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        template <typename T>
+        T ReadField(const u8* bytes, usize offset) {
+            T value;
+            memcpy(&value, bytes + offset, sizeof(T));
+            return value;
+        }
+    } // namespace
+
+    PYRO_COMMON_API FlightRecorderReader::FlightRecorderReader(IStreamReader& reader) {
+        using internal::FlightRecorderFileHeader;
+        using internal::FlightRecorderRecordHeader;
+
+        u8 header[sizeof(FlightRecorderFileHeader)];
+        if (reader.Read(header, sizeof(header)) != sizeof(header) ||
+            memcmp(header, internal::FLIGHT_RECORDER_MAGIC, sizeof(internal::FLIGHT_RECORDER_MAGIC)) != 0 ||
+            ReadField<u32>(header, offsetof(FlightRecorderFileHeader, version)) != internal::FLIGHT_RECORDER_VERSION) {
+            return;
+        }
+        const u32 headerSize = ReadField<u32>(header, offsetof(FlightRecorderFileHeader, headerSize));
+        const u32 recordSize = ReadField<u32>(header, offsetof(FlightRecorderFileHeader, recordSize));
+        const u32 recordCount = ReadField<u32>(header, offsetof(FlightRecorderFileHeader, recordCount));
+        if (headerSize < sizeof(FlightRecorderFileHeader) || recordSize <= sizeof(FlightRecorderRecordHeader) || recordCount == 0) {
+            return;
+        }
+        mStartTime = ReadField<u64>(header, offsetof(FlightRecorderFileHeader, startTime));
+        mLoggedCount = ReadField<u64>(header, offsetof(FlightRecorderFileHeader, nextSequence));
+        mValid = true;
+
+        eastl::vector<u8> skipped(headerSize - sizeof(FlightRecorderFileHeader));
+        if (reader.Read(skipped.data(), skipped.size()) != skipped.size()) {
+            return;
+        }
+        const usize capacity = recordSize - sizeof(FlightRecorderRecordHeader);
+        eastl::vector<u8> slot(recordSize);
+        for (u32 index = 0; index < recordCount; ++index) {
+            if (reader.Read(slot.data(), recordSize) != recordSize) {
+                break;
+            }
+            const u64 sequence = ReadField<u64>(slot.data(), offsetof(FlightRecorderRecordHeader, sequence));
+            const u32 severity = ReadField<u32>(slot.data(), offsetof(FlightRecorderRecordHeader, severity));
+            const u32 length = ReadField<u32>(slot.data(), offsetof(FlightRecorderRecordHeader, length));
+            // empty, torn by the crash, or not where its sequence says it should be
+            if (sequence == 0 || sequence == internal::FLIGHT_RECORDER_BUSY || (sequence - 1) % recordCount != index ||
+                length > capacity || severity > static_cast<u32>(LogSeverity::Fatal)) {
+                continue;
+            }
+            FlightRecord& record = mRecords.emplace_back();
+            record.sequence = sequence - 1;
+            record.timestamp = ReadField<u64>(slot.data(), offsetof(FlightRecorderRecordHeader, timestamp));
+            record.severity = static_cast<LogSeverity>(severity);
+            record.thread = ReadField<u32>(slot.data(), offsetof(FlightRecorderRecordHeader, thread));
+            record.message.assign(reinterpret_cast<const char*>(slot.data() + sizeof(FlightRecorderRecordHeader)), length);
+        }
+        eastl::sort(mRecords.begin(), mRecords.end(), [](const FlightRecord& a, const FlightRecord& b) { return a.sequence < b.sequence; });
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,72 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Stream/IStreamReader.hpp>
+
+#include <EASTL/span.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    struct FlightRecord {
+        // Index of the message since the recorder was opened
+        u64 sequence = 0;
+        // Nanoseconds since the Unix epoch
+        u64 timestamp = 0;
+        LogSeverity severity = LogSeverity::Verbose;
+        // Index of the logging thread, in order of the first message of each thread
+        u32 thread = 0;
+        eastl::string message = {};
+    };
+
+    // Reads back the ring of a FlightRecorderLogStream, e.g. from the file left behind by a crashed process.
+    // Records that were being written at the time of the crash are skipped.
+    class FlightRecorderReader : DeleteCopy {
+    public:
+        /// Reads the whole ring from `reader`.
+        PYRO_COMMON_API explicit FlightRecorderReader(IStreamReader& reader);
+
+        /// False if the stream doesn't start with a flight recorder header.
+        PYRO_NODISCARD bool IsValid() const noexcept { return mValid; }
+        /// Nanoseconds since the Unix epoch when the recorder was opened.
+        PYRO_NODISCARD u64 StartTime() const noexcept { return mStartTime; }
+        /// Number of messages logged since the recorder was opened, including the ones overwritten since.
+        PYRO_NODISCARD u64 LoggedCount() const noexcept { return mLoggedCount; }
+
+        /// The records still in the ring, oldest first.
+        PYRO_NODISCARD eastl::span<const FlightRecord> Records() const noexcept { return { mRecords.data(), mRecords.size() }; }
+        /// The last `count` records, oldest first.
+        PYRO_NODISCARD eastl::span<const FlightRecord> LastRecords(usize count) const noexcept {
+            const usize first = mRecords.size() > count ? mRecords.size() - count : 0;
+            return Records().subspan(first);
+        }
+
+    private:
+        eastl::vector<FlightRecord> mRecords = {};
+        bool mValid = false;
+        u64 mStartTime = 0;
+        u64 mLoggedCount = 0;
+    };
+} // namespace PyroshockStudios
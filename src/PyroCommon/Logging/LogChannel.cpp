@@ -0,0 +1,215 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LogChannel.hpp"
+
+#include <PyroCommon/CommandLineParser.hpp>
+
+#include <EASTL/string_map.h>
+#include <mutex>
+
+namespace PyroshockStudios {
+    namespace {
+        struct LogChannelRegistryState {
+            std::mutex mutex;
+            eastl::string_map<LogChannel*> channels;
+            u32 defaultSeverity = static_cast<u32>(LogSeverity::Verbose);
+            ILogStream* defaultStream = nullptr;
+        };
+
+        LogChannelRegistryState& GetRegistryState() {
+            // leaked, channels may still be logged to during static destruction
+            static LogChannelRegistryState* state = new LogChannelRegistryState();
+            return *state;
+        }
+
+        constexpr eastl::string_view SEVERITY_NAMES[] = { "verbose", "debug", "trace", "info", "warn", "error", "fatal" };
+        constexpr eastl::string_view CHANNEL_OPTION_PREFIX = "log.";
+    } // namespace
+
+    PYRO_COMMON_API void LogChannel::SetMinSeverity(LogSeverity severity) {
+        std::lock_guard lock(GetRegistryState().mutex);
+        mSeverity = static_cast<u32>(severity);
+        Update();
+    }
+
+    PYRO_COMMON_API void LogChannel::Disable() {
+        std::lock_guard lock(GetRegistryState().mutex);
+        mSeverity = SEVERITY_OFF;
+        Update();
+    }
+
+    PYRO_COMMON_API void LogChannel::ResetMinSeverity() {
+        std::lock_guard lock(GetRegistryState().mutex);
+        mSeverity = SEVERITY_DEFAULT;
+        Update();
+    }
+
+    PYRO_COMMON_API void LogChannel::SetStream(ILogStream* stream) {
+        std::lock_guard lock(GetRegistryState().mutex);
+        mStream = stream;
+        Update();
+    }
+
+    PYRO_COMMON_API void LogChannel::Update() {
+        const LogChannelRegistryState& state = GetRegistryState();
+        ILogStream* target = mStream ? mStream : state.defaultStream;
+        u32 severity = mSeverity != SEVERITY_DEFAULT ? mSeverity : state.defaultSeverity;
+        if (!target) {
+            severity = SEVERITY_OFF;
+        } else if (static_cast<u32>(target->MinSeverity()) > severity) {
+            // the stream would drop these anyway, this saves the formatting
+            severity = static_cast<u32>(target->MinSeverity());
+        }
+        mTarget.store(target, eastl::memory_order_release);
+        mEffectiveSeverity.store(severity, eastl::memory_order_relaxed);
+    }
+
+    PYRO_COMMON_API LogChannel& LogChannelRegistry::Get(const char* name) {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        auto it = state.channels.find(name);
+        if (it != state.channels.end()) {
+            return *it->second;
+        }
+        LogChannel* channel = new LogChannel(name);
+        channel->Update();
+        state.channels[channel->Name()] = channel;
+        return *channel;
+    }
+
+    PYRO_COMMON_API LogChannel* LogChannelRegistry::Find(const char* name) {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        auto it = state.channels.find(name);
+        return it != state.channels.end() ? it->second : nullptr;
+    }
+
+    PYRO_COMMON_API eastl::vector<LogChannel*> LogChannelRegistry::Channels() {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        eastl::vector<LogChannel*> channels;
+        channels.reserve(state.channels.size());
+        for (const auto& [name, channel] : state.channels) {
+            channels.push_back(channel);
+        }
+        return channels;
+    }
+
+    PYRO_COMMON_API void LogChannelRegistry::SetDefaultSeverity(LogSeverity severity) {
+        SetDefault(static_cast<u32>(severity));
+    }
+
+    PYRO_COMMON_API void LogChannelRegistry::DisableByDefault() {
+        SetDefault(LogChannel::SEVERITY_OFF);
+    }
+
+    PYRO_COMMON_API void LogChannelRegistry::SetDefault(u32 severity) {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        state.defaultSeverity = severity;
+        for (const auto& [name, channel] : state.channels) {
+            channel->Update();
+        }
+    }
+
+    PYRO_COMMON_API void LogChannelRegistry::SetDefaultStream(ILogStream* stream) {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        state.defaultStream = stream;
+        for (const auto& [name, channel] : state.channels) {
+            channel->Update();
+        }
+    }
+
+    PYRO_COMMON_API void LogChannelRegistry::Refresh() {
+        LogChannelRegistryState& state = GetRegistryState();
+        std::lock_guard lock(state.mutex);
+        for (const auto& [name, channel] : state.channels) {
+            channel->Update();
+        }
+    }
+
+    PYRO_COMMON_API u32 LogChannelRegistry::Configure(const CommandLineParser& options) {
+        u32 applied = 0;
+        // the options come out of a hash map, two passes keep -log from overriding a channel option
+        options.QueryOptions([&applied](const auto& key, const eastl::string& value) {
+            if (eastl::string_view(key) != "log") {
+                return;
+            }
+            LogSeverity severity = LogSeverity::Verbose;
+            bool enabled = true;
+            if (!ParseSeverity(eastl::string_view(value.data(), value.size()), severity, enabled)) {
+                return;
+            }
+            if (enabled) {
+                SetDefaultSeverity(severity);
+            } else {
+                DisableByDefault();
+            }
+            ++applied;
+        });
+        options.QueryOptions([&applied](const auto& key, const eastl::string& value) {
+            const eastl::string_view keyView = key;
+            if (!keyView.starts_with(CHANNEL_OPTION_PREFIX)) {
+                return;
+            }
+            LogSeverity severity = LogSeverity::Verbose;
+            bool enabled = true;
+            if (!ParseSeverity(eastl::string_view(value.data(), value.size()), severity, enabled)) {
+                return;
+            }
+            // a suffix of the key, still null-terminated
+            LogChannel& channel = Get(keyView.data() + CHANNEL_OPTION_PREFIX.size());
+            if (enabled) {
+                channel.SetMinSeverity(severity);
+            } else {
+                channel.Disable();
+            }
+            ++applied;
+        });
+        return applied;
+    }
+
+    PYRO_COMMON_API bool LogChannelRegistry::ParseSeverity(eastl::string_view text, LogSeverity& severity, bool& enabled) {
+        char lower[16] = {};
+        if (text.empty() || text.size() >= sizeof(lower)) {
+            return false;
+        }
+        for (usize i = 0; i < text.size(); ++i) {
+            lower[i] = static_cast<char>(tolower(static_cast<unsigned char>(text[i])));
+        }
+        const eastl::string_view name(lower, text.size());
+        if (name == "off") {
+            enabled = false;
+            return true;
+        }
+        for (u32 i = 0; i < eastl::size(SEVERITY_NAMES); ++i) {
+            if (SEVERITY_NAMES[i] == name) {
+                severity = static_cast<LogSeverity>(i);
+                enabled = true;
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace PyroshockStudios
\ No newline at end of file
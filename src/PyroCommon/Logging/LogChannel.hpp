@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    inline namespace Util {
+        class CommandLineParser;
+    }
+
+    // Named log target for one subsystem, obtained from LogChannelRegistry and never destroyed.
+    // The effective minimum severity is cached so checking it is a single relaxed load:
+    //   static LogChannel& gNetLog = LogChannelRegistry::Get("net");
+    //   PYRO_LOG_WARN(gNetLog, "peer {} timed out", peer);
+    // Severity and stream fall back to the registry defaults until they are set on the channel.
+    class LogChannel : DeleteCopy, DeleteMove {
+    public:
+        PYRO_NODISCARD PYRO_FORCEINLINE bool IsEnabled(LogSeverity severity) const noexcept {
+            return static_cast<u32>(severity) >= mEffectiveSeverity.load(eastl::memory_order_relaxed);
+        }
+        /// The stream messages go to, null if neither the channel nor the registry has one.
+        PYRO_NODISCARD PYRO_FORCEINLINE ILogStream* Stream() const noexcept {
+            return mTarget.load(eastl::memory_order_acquire);
+        }
+        PYRO_NODISCARD PYRO_FORCEINLINE const char* Name() const noexcept { return mName.c_str(); }
+
+        PYRO_COMMON_API void SetMinSeverity(LogSeverity severity);
+        /// Drops every message until the severity is set again.
+        PYRO_COMMON_API void Disable();
+        /// Follows the registry default severity again.
+        PYRO_COMMON_API void ResetMinSeverity();
+        /// Null follows the registry default stream.
+        PYRO_COMMON_API void SetStream(ILogStream* stream);
+
+    private:
+        friend class LogChannelRegistry;
+
+        static constexpr u32 SEVERITY_DEFAULT = ~0u;
+        static constexpr u32 SEVERITY_OFF = static_cast<u32>(LogSeverity::Fatal) + 1;
+
+        explicit LogChannel(const char* name) : mName(name) {}
+
+        // Recomputes the cached target and severity, called with the registry lock held
+        PYRO_COMMON_API void Update();
+
+        eastl::atomic<u32> mEffectiveSeverity = SEVERITY_OFF;
+        eastl::atomic<ILogStream*> mTarget = nullptr;
+        u32 mSeverity = SEVERITY_DEFAULT;
+        ILogStream* mStream = nullptr;
+        eastl::string mName;
+    };
+
+    // Process-wide set of LogChannels. Levels can be changed at any time, from code or from the command line:
+    //   -log=Warn          default severity of every channel
+    //   -log.net=Verbose   severity of the "net" channel
+    // Severities are LogSeverity names (any case) or Off.
+    class LogChannelRegistry {
+    public:
+        /// Returns the channel called `name`, creating it on first use. The reference stays valid forever.
+        PYRO_NODISCARD PYRO_COMMON_API static LogChannel& Get(const char* name);
+        /// Returns null if no channel called `name` exists yet.
+        PYRO_NODISCARD PYRO_COMMON_API static LogChannel* Find(const char* name);
+        PYRO_NODISCARD PYRO_COMMON_API static eastl::vector<LogChannel*> Channels();
+
+        PYRO_COMMON_API static void SetDefaultSeverity(LogSeverity severity);
+        /// Turns off every channel without a severity of its own, including ones created later.
+        PYRO_COMMON_API static void DisableByDefault();
+        PYRO_COMMON_API static void SetDefaultStream(ILogStream* stream);
+        /// Re-reads MinSeverity() of the streams, for streams whose severity changed after they were set.
+        PYRO_COMMON_API static void Refresh();
+
+        /// Applies the -log and -log.<channel> options, creating channels that don't exist yet.
+        /// -log is applied first, so a channel option always wins over it.
+        /// @return the number of options applied, options with an unknown severity are skipped.
+        PYRO_COMMON_API static u32 Configure(const CommandLineParser& options);
+
+        /// Parses a LogSeverity name, or Off which yields false in `enabled`.
+        PYRO_NODISCARD PYRO_COMMON_API static bool ParseSeverity(eastl::string_view text, LogSeverity& severity, bool& enabled);
+
+    private:
+        PYRO_COMMON_API static void SetDefault(u32 severity);
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
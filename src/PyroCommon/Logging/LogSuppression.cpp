@@ -0,0 +1,273 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/utility.h>
+#include <chrono>
+#include <fmt/format.h>
+#include <mutex>
+
+namespace PyroshockStudios {
+    namespace {
+        struct LogSuppressionState {
+            eastl::atomic<u32> ratePerSecond;
+            eastl::atomic<u32> burst;
+            eastl::atomic<u32> coalesceWindowMs;
+            eastl::atomic<u32> exemptSeverity;
+
+            std::mutex sitesMutex;
+            eastl::vector<eastl::pair<const LogSite*, LogSiteState*>> sites;
+        };
+
+        LogSuppressionState& GetSuppressionState() {
+            // leaked, sites may still log during static destruction
+            static LogSuppressionState* state = [] {
+                LogSuppressionState* result = new LogSuppressionState();
+                const LogSuppressionConfig defaults = {};
+                result->ratePerSecond.store(defaults.ratePerSecond, eastl::memory_order_relaxed);
+                result->burst.store(defaults.burst, eastl::memory_order_relaxed);
+                result->coalesceWindowMs.store(defaults.coalesceWindowMs, eastl::memory_order_relaxed);
+                result->exemptSeverity.store(static_cast<u32>(defaults.exemptSeverity), eastl::memory_order_relaxed);
+                return result;
+            }();
+            return *state;
+        }
+
+        i64 NowNanoseconds() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // FNV-1a, only compared against the previous message of the same site
+        u64 HashMessage(const char* message, usize length) {
+            u64 hash = 0xcbf29ce484222325ull;
+            for (usize i = 0; i < length; ++i) {
+                hash = (hash ^ static_cast<u8>(message[i])) * 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        template <typename... Args>
+        void LogNotice(const LogSite& site, ILogStream* stream, fmt::format_string<Args...> format, Args&&... args) {
+            fmt::memory_buffer buffer;
+            fmt::format_to(fmt::appender(buffer), format, std::forward<Args>(args)...);
+            buffer.push_back('\0');
+            stream->Log(site, buffer.data(), buffer.size() - 1);
+        }
+    } // namespace
+
+    PYRO_COMMON_API void LogSiteState::Submit(const LogSite& site, ILogStream* stream, const char* message, usize length) {
+        LogSuppressionState& state = GetSuppressionState();
+        if (static_cast<u32>(site.severity) >= state.exemptSeverity.load(eastl::memory_order_relaxed)) {
+            stream->Log(site, message, length);
+            return;
+        }
+        StreamState& streamState = Acquire(site, stream);
+        const i64 now = NowNanoseconds();
+        const u32 windowMs = state.coalesceWindowMs.load(eastl::memory_order_relaxed);
+
+        // a storm that nothing got through after is reported once its window is over, even if this message is dropped
+        const i64 reportAfter = static_cast<i64>(windowMs != 0 ? windowMs : 1000) * 1'000'000;
+        const i64 lastActivity = eastl::max(streamState.windowStart.load(eastl::memory_order_relaxed), streamState.lastReport.load(eastl::memory_order_relaxed));
+        if (now - lastActivity >= reportAfter &&
+            (streamState.repeats.load(eastl::memory_order_relaxed) != 0 || streamState.pendingRateLimited.load(eastl::memory_order_relaxed) != 0)) {
+            ReportPending(site, streamState, now);
+        }
+
+        // duplicates are coalesced before rate limiting, so a storm of one message costs no tokens
+        u64 hash = 0;
+        if (windowMs != 0) {
+            hash = HashMessage(message, length);
+            const i64 elapsed = now - streamState.windowStart.load(eastl::memory_order_relaxed);
+            if (streamState.lastHash.load(eastl::memory_order_relaxed) == hash && elapsed < static_cast<i64>(windowMs) * 1'000'000) {
+                streamState.repeats.fetch_add(1, eastl::memory_order_relaxed);
+                mCoalesced.fetch_add(1, eastl::memory_order_relaxed);
+                return;
+            }
+        }
+
+        if (const u32 rate = state.ratePerSecond.load(eastl::memory_order_relaxed); rate != 0) {
+            if (!TakeToken(streamState, now, rate, state.burst.load(eastl::memory_order_relaxed))) {
+                streamState.pendingRateLimited.fetch_add(1, eastl::memory_order_relaxed);
+                mRateLimited.fetch_add(1, eastl::memory_order_relaxed);
+                return;
+            }
+        }
+
+        // only a message that reaches the stream can be the "previous message" of later repeats
+        ReportPending(site, streamState, now);
+        if (windowMs != 0) {
+            streamState.lastHash.store(hash, eastl::memory_order_relaxed);
+        }
+        streamState.windowStart.store(now, eastl::memory_order_relaxed);
+        stream->Log(site, message, length);
+    }
+
+    PYRO_COMMON_API void LogSiteState::FlushPending(const LogSite& site, ILogStream* only) {
+        const i64 now = NowNanoseconds();
+        for (StreamState* streamState = mStreams.load(eastl::memory_order_acquire); streamState; streamState = streamState->next) {
+            ILogStream* stream = streamState->stream.load(eastl::memory_order_acquire);
+            if (!stream || (only && stream != only)) {
+                continue;
+            }
+            ReportPending(site, *streamState, now);
+            // later copies of the last message start a new window rather than adding to a reported one
+            streamState->windowStart.store(now, eastl::memory_order_relaxed);
+        }
+    }
+
+    LogSiteState::StreamState& LogSiteState::Acquire(const LogSite& site, ILogStream* stream) {
+        StreamState* head = mStreams.load(eastl::memory_order_acquire);
+        for (StreamState* streamState = head; streamState; streamState = streamState->next) {
+            if (streamState->stream.load(eastl::memory_order_acquire) == stream) {
+                return *streamState;
+            }
+        }
+        for (StreamState* streamState = head; streamState; streamState = streamState->next) {
+            ILogStream* expected = nullptr;
+            if (streamState->stream.compare_exchange_strong(expected, stream, eastl::memory_order_acq_rel)) {
+                return *streamState;
+            }
+        }
+
+        // threads racing on a stream's first message may each add a slot for it, which only splits its counters
+        StreamState* streamState = new StreamState();
+        streamState->stream.store(stream, eastl::memory_order_relaxed);
+        streamState->next = head;
+        while (!mStreams.compare_exchange_weak(streamState->next, streamState, eastl::memory_order_acq_rel, eastl::memory_order_acquire)) {
+        }
+        if (!streamState->next) {
+            // first stream of this site
+            LogSuppressionState& state = GetSuppressionState();
+            std::lock_guard lock(state.sitesMutex);
+            state.sites.emplace_back(&site, this);
+        }
+        return *streamState;
+    }
+
+    void LogSiteState::ReportPending(const LogSite& site, StreamState& streamState, i64 now) {
+        ILogStream* stream = streamState.stream.load(eastl::memory_order_relaxed);
+        streamState.lastReport.store(now, eastl::memory_order_relaxed);
+        if (const u32 repeats = streamState.repeats.exchange(0, eastl::memory_order_relaxed); repeats != 0) {
+            const i64 elapsed = now - streamState.windowStart.load(eastl::memory_order_relaxed);
+            LogNotice(site, stream, "previous message repeated {} times in the last {} ms", repeats, elapsed / 1'000'000);
+        }
+        if (const u32 dropped = streamState.pendingRateLimited.exchange(0, eastl::memory_order_relaxed); dropped != 0) {
+            LogNotice(site, stream, "{} messages dropped by the rate limit of {}/s", dropped,
+                GetSuppressionState().ratePerSecond.load(eastl::memory_order_relaxed));
+        }
+    }
+
+    void LogSiteState::RemoveStream(const LogSite& site, ILogStream* stream) {
+        const i64 now = NowNanoseconds();
+        for (StreamState* streamState = mStreams.load(eastl::memory_order_acquire); streamState; streamState = streamState->next) {
+            if (streamState->stream.load(eastl::memory_order_acquire) != stream) {
+                continue;
+            }
+            ReportPending(site, *streamState, now);
+            streamState->theoreticalArrival.store(0, eastl::memory_order_relaxed);
+            streamState->lastHash.store(0, eastl::memory_order_relaxed);
+            streamState->windowStart.store(0, eastl::memory_order_relaxed);
+            streamState->lastReport.store(0, eastl::memory_order_relaxed);
+            // a later stream may take over the slot from here on
+            streamState->stream.store(nullptr, eastl::memory_order_release);
+        }
+    }
+
+    bool LogSiteState::TakeToken(StreamState& streamState, i64 now, u32 ratePerSecond, u32 burst) {
+        const i64 interval = 1'000'000'000 / static_cast<i64>(ratePerSecond);
+        const i64 tolerance = interval * static_cast<i64>(burst > 0 ? burst - 1 : 0);
+        i64 arrival = streamState.theoreticalArrival.load(eastl::memory_order_relaxed);
+        i64 next;
+        do {
+            const i64 start = eastl::max(arrival, now);
+            if (start - now > tolerance)
+                return false;
+            next = start + interval;
+        } while (!streamState.theoreticalArrival.compare_exchange_weak(arrival, next, eastl::memory_order_relaxed));
+        return true;
+    }
+
+    PYRO_COMMON_API void LogSuppression::SetConfig(const LogSuppressionConfig& config) {
+        LogSuppressionState& state = GetSuppressionState();
+        state.ratePerSecond.store(config.ratePerSecond, eastl::memory_order_relaxed);
+        state.burst.store(config.burst, eastl::memory_order_relaxed);
+        state.coalesceWindowMs.store(config.coalesceWindowMs, eastl::memory_order_relaxed);
+        state.exemptSeverity.store(static_cast<u32>(config.exemptSeverity), eastl::memory_order_relaxed);
+    }
+
+    PYRO_COMMON_API LogSuppressionConfig LogSuppression::Config() {
+        const LogSuppressionState& state = GetSuppressionState();
+        LogSuppressionConfig config;
+        config.ratePerSecond = state.ratePerSecond.load(eastl::memory_order_relaxed);
+        config.burst = state.burst.load(eastl::memory_order_relaxed);
+        config.coalesceWindowMs = state.coalesceWindowMs.load(eastl::memory_order_relaxed);
+        config.exemptSeverity = static_cast<LogSeverity>(state.exemptSeverity.load(eastl::memory_order_relaxed));
+        return config;
+    }
+
+    PYRO_COMMON_API void LogSuppression::FlushPending(ILogStream* stream) {
+        eastl::vector<eastl::pair<const LogSite*, LogSiteState*>> sites;
+        {
+            // the notices are logged outside the lock, a stream may log through a suppressed site itself
+            LogSuppressionState& state = GetSuppressionState();
+            std::lock_guard lock(state.sitesMutex);
+            sites = state.sites;
+        }
+        for (const auto& [site, siteState] : sites) {
+            siteState->FlushPending(*site, stream);
+        }
+    }
+
+    PYRO_COMMON_API void LogSuppression::RemoveStream(ILogStream* stream) {
+        eastl::vector<eastl::pair<const LogSite*, LogSiteState*>> sites;
+        {
+            LogSuppressionState& state = GetSuppressionState();
+            std::lock_guard lock(state.sitesMutex);
+            sites = state.sites;
+        }
+        for (const auto& [site, siteState] : sites) {
+            siteState->RemoveStream(*site, stream);
+        }
+    }
+
+    PYRO_COMMON_API LogSuppressionStats LogSuppression::Stats() {
+        LogSuppressionStats total;
+        for (const LogSiteSuppressionStats& site : SiteStats()) {
+            total.rateLimited += site.stats.rateLimited;
+            total.coalesced += site.stats.coalesced;
+        }
+        return total;
+    }
+
+    PYRO_COMMON_API eastl::vector<LogSiteSuppressionStats> LogSuppression::SiteStats() {
+        LogSuppressionState& state = GetSuppressionState();
+        std::lock_guard lock(state.sitesMutex);
+        eastl::vector<LogSiteSuppressionStats> result;
+        result.reserve(state.sites.size());
+        for (const auto& [site, siteState] : state.sites) {
+            result.push_back({ site, siteState->Stats() });
+        }
+        return result;
+    }
+} // namespace PyroshockStudios
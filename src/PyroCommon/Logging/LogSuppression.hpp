@@ -0,0 +1,116 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    // Limits applied to every PYRO_LOG_* call site, to keep a failure in a loop from swamping the streams
+    struct LogSuppressionConfig {
+        // Token bucket per call site, `burst` messages at once refilled at `ratePerSecond`. 0 disables rate limiting.
+        u32 ratePerSecond = 20;
+        u32 burst = 50;
+        // Identical messages from one call site within this window are counted instead of logged. 0 disables coalescing.
+        u32 coalesceWindowMs = 1000;
+        // Messages at or above this severity are never suppressed
+        LogSeverity exemptSeverity = LogSeverity::Warn;
+    };
+
+    struct LogSuppressionStats {
+        u64 rateLimited = 0;
+        u64 coalesced = 0;
+    };
+
+    struct LogSiteSuppressionStats {
+        const LogSite* site;
+        LogSuppressionStats stats;
+    };
+
+    // Mutable suppression state of one call site, the PYRO_LOG_* macros declare one next to the LogSite.
+    // Every stream the site logs to is limited and coalesced on its own.
+    // Updates are lock-free, so under contention a few duplicates may slip through or be counted in the next window.
+    class LogSiteState : DeleteCopy, DeleteMove {
+    public:
+        constexpr LogSiteState() = default;
+
+        /// Logs `message` to `stream` unless it is suppressed. Messages suppressed earlier are reported first,
+        /// e.g. "previous message repeated 41 times in the last 1000 ms", and at the latest by the first call
+        /// after the coalescing window ran out, even if that call is suppressed itself.
+        PYRO_COMMON_API void Submit(const LogSite& site, ILogStream* stream, const char* message, usize length);
+
+        /// Reports what was suppressed since the last message that got through, to the stream it was meant for.
+        /// @param only Skips every stream but this one, null for all of them.
+        PYRO_COMMON_API void FlushPending(const LogSite& site, ILogStream* only);
+
+        PYRO_NODISCARD LogSuppressionStats Stats() const noexcept {
+            return { mRateLimited.load(eastl::memory_order_relaxed), mCoalesced.load(eastl::memory_order_relaxed) };
+        }
+
+    private:
+        friend class LogSuppression;
+
+        // Suppression state for one stream, never freed, a slot whose stream was removed is reused
+        struct StreamState {
+            eastl::atomic<ILogStream*> stream = nullptr;
+            StreamState* next = nullptr;
+            // GCRA form of the token bucket, the time at which the bucket is full again
+            eastl::atomic<i64> theoreticalArrival = 0;
+            eastl::atomic<u64> lastHash = 0;
+            eastl::atomic<i64> windowStart = 0;
+            eastl::atomic<i64> lastReport = 0;
+            eastl::atomic<u32> repeats = 0;
+            eastl::atomic<u32> pendingRateLimited = 0;
+        };
+
+        PYRO_NODISCARD StreamState& Acquire(const LogSite& site, ILogStream* stream);
+        PYRO_NODISCARD static bool TakeToken(StreamState& state, i64 now, u32 ratePerSecond, u32 burst);
+        void ReportPending(const LogSite& site, StreamState& state, i64 now);
+        // Reports what is pending for `stream` and frees its slot
+        void RemoveStream(const LogSite& site, ILogStream* stream);
+
+        eastl::atomic<StreamState*> mStreams = nullptr;
+        eastl::atomic<u64> mRateLimited = 0;
+        eastl::atomic<u64> mCoalesced = 0;
+    };
+
+    class LogSuppression {
+    public:
+        PYRO_COMMON_API static void SetConfig(const LogSuppressionConfig& config);
+        PYRO_NODISCARD PYRO_COMMON_API static LogSuppressionConfig Config();
+
+        /// Reports the messages still held back at every call site, e.g. once a storm is over. Streams call this
+        /// with themselves from their Flush(), pass null only while every stream logged to is still alive.
+        PYRO_COMMON_API static void FlushPending(ILogStream* stream = nullptr);
+        /// Reports what is still held back for `stream` and forgets it, streams call this first thing in their
+        /// destructor so no call site keeps pointing at them.
+        PYRO_COMMON_API static void RemoveStream(ILogStream* stream);
+
+        /// Suppressed messages over all call sites since startup.
+        PYRO_NODISCARD PYRO_COMMON_API static LogSuppressionStats Stats();
+        /// Call sites that suppressed at least one message.
+        PYRO_NODISCARD PYRO_COMMON_API static eastl::vector<LogSiteSuppressionStats> SiteStats();
+    };
+} // namespace PyroshockStudios
@@ -0,0 +1,409 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "PerThreadLogStream.hpp"
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/heap.h>
+#include <bit>
+#include <fmt/format.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        using internal::PerThreadLogBuffer;
+        using internal::PerThreadLogRecord;
+
+        struct ThreadBufferEntry {
+            u64 streamId;
+            PerThreadLogBuffer* buffer;
+        };
+
+        // Ids of the streams still alive, so exiting threads don't touch the rings of destroyed streams
+        struct LiveStreams {
+            std::mutex mutex;
+            eastl::vector<u64> ids;
+        };
+
+        LiveStreams& GetLiveStreams() {
+            // leaked, threads may exit during static destruction
+            static LiveStreams* streams = new LiveStreams();
+            return *streams;
+        }
+
+        bool IsLive(const LiveStreams& streams, u64 id) {
+            return eastl::find(streams.ids.begin(), streams.ids.end(), id) != streams.ids.end();
+        }
+
+        // the last ring used is cached in trivially destructible thread_locals, no init guard on the fast path
+        thread_local u64 tLastStreamId = 0;
+        thread_local PerThreadLogBuffer* tLastBuffer = nullptr;
+        // set once the thread's rings were handed back, thread_locals destroyed later may still log
+        thread_local bool tThreadBuffersReleased = false;
+
+        // Every ring the thread owns, handed back to the collectors when the thread exits
+        struct ThreadBuffers {
+            ~ThreadBuffers() {
+                // the collector frees abandoned rings, later messages take the slow path and are dropped there
+                tLastStreamId = 0;
+                tLastBuffer = nullptr;
+                tThreadBuffersReleased = true;
+                LiveStreams& streams = GetLiveStreams();
+                std::lock_guard lock(streams.mutex);
+                for (const ThreadBufferEntry& entry : entries) {
+                    if (IsLive(streams, entry.streamId)) {
+                        entry.buffer->abandoned.store(true, eastl::memory_order_release);
+                    }
+                }
+            }
+
+            eastl::vector<ThreadBufferEntry> entries;
+        };
+
+        thread_local ThreadBuffers tThreadBuffers;
+
+        constexpr usize RecordSize(usize length) {
+            return PYRO_ALIGN(sizeof(PerThreadLogRecord) + length + 1, alignof(PerThreadLogRecord));
+        }
+
+        struct RingCursor {
+            PerThreadLogBuffer* buffer;
+            u64 position;
+            u64 end;
+            const PerThreadLogRecord* record;
+            // the thread exited and everything it logged has been delivered
+            bool release;
+        };
+
+        // Moves to the next record stamped up to `watermark`, or leaves `record` null
+        void Advance(RingCursor& cursor, u64 watermark) {
+            const usize mask = cursor.buffer->capacity - 1;
+            cursor.record = nullptr;
+            while (cursor.position < cursor.end) {
+                const usize offset = cursor.position & mask;
+                const usize contiguous = cursor.buffer->capacity - offset;
+                if (contiguous < sizeof(PerThreadLogRecord)) {
+                    cursor.position += contiguous;
+                    continue;
+                }
+                const auto* record = reinterpret_cast<const PerThreadLogRecord*>(cursor.buffer->data + offset);
+                if (record->length == PerThreadLogRecord::PADDING) {
+                    cursor.position += contiguous;
+                    continue;
+                }
+                if (record->timestamp <= watermark) {
+                    cursor.record = record;
+                }
+                return;
+            }
+        }
+    } // namespace
+
+    PYRO_COMMON_API PerThreadLogStream::PerThreadLogStream(eastl::span<ILogStream* const> sinks, u32 bufferSize, LogOverflowPolicy policy,
+        u32 flushIntervalMs)
+        : mBufferSize(std::bit_ceil(eastl::max<usize>(bufferSize, 1024))), mPolicy(policy), mFlushIntervalMs(eastl::max(flushIntervalMs, 1u)),
+          mSinks(sinks.begin(), sinks.end()) {
+        static eastl::atomic<u64> gNextStreamId = 1;
+        mId = gNextStreamId.fetch_add(1, eastl::memory_order_relaxed);
+        for (ILogStream* sink : mSinks) {
+            if (sink->MinSeverity() < mMinSeverity) {
+                mMinSeverity = sink->MinSeverity();
+            }
+        }
+        {
+            LiveStreams& streams = GetLiveStreams();
+            std::lock_guard lock(streams.mutex);
+            streams.ids.push_back(mId);
+        }
+        mCollectorThread = std::thread([this]() { CollectorThreadMain(); });
+    }
+
+    PYRO_COMMON_API PerThreadLogStream::~PerThreadLogStream() {
+        LogSuppression::RemoveStream(this);
+        {
+            LiveStreams& streams = GetLiveStreams();
+            std::lock_guard lock(streams.mutex);
+            streams.ids.erase(eastl::find(streams.ids.begin(), streams.ids.end(), mId));
+        }
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mWake.notify_one();
+        mCollectorThread.join();
+        for (PerThreadLogBuffer* buffer : mBuffers) {
+            delete[] buffer->data;
+            delete buffer;
+        }
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        if (severity < mMinSeverity) {
+            return;
+        }
+        Append(severity, nullptr, message, length);
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Log(const LogSite& site, const char* message, usize length) {
+        if (site.severity < mMinSeverity) {
+            return;
+        }
+        Append(site.severity, &site, message, length);
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Flush() {
+        LogSuppression::FlushPending(this);
+        std::unique_lock lock(mMutex);
+        const u64 target = ++mFlushRequested;
+        mWake.notify_one();
+        mFlushed.wait(lock, [&]() { return mFlushCompleted >= target; });
+    }
+
+    PYRO_COMMON_API u64 PerThreadLogStream::DroppedCount() const {
+        std::lock_guard lock(mBuffersMutex);
+        u64 dropped = mReleasedDrops.load(eastl::memory_order_relaxed);
+        for (const PerThreadLogBuffer* buffer : mBuffers) {
+            dropped += buffer->dropped.load(eastl::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    PYRO_COMMON_API u32 PerThreadLogStream::BufferCount() const {
+        std::lock_guard lock(mBuffersMutex);
+        return static_cast<u32>(mBuffers.size());
+    }
+
+    PYRO_COMMON_API PerThreadLogBuffer* PerThreadLogStream::AcquireThreadBuffer() {
+        if (tThreadBuffersReleased) {
+            return nullptr;
+        }
+        ThreadBuffers& owned = tThreadBuffers;
+        for (const ThreadBufferEntry& entry : owned.entries) {
+            if (entry.streamId == mId) {
+                tLastStreamId = mId;
+                tLastBuffer = entry.buffer;
+                return entry.buffer;
+            }
+        }
+
+        auto* buffer = new PerThreadLogBuffer();
+        buffer->capacity = mBufferSize;
+        buffer->data = new u8[mBufferSize];
+        {
+            std::lock_guard lock(mBuffersMutex);
+            mBuffers.push_back(buffer);
+        }
+        {
+            LiveStreams& streams = GetLiveStreams();
+            std::lock_guard lock(streams.mutex);
+            // forgets the rings of destroyed streams
+            owned.entries.erase(eastl::remove_if(owned.entries.begin(), owned.entries.end(),
+                                    [&](const ThreadBufferEntry& entry) { return !IsLive(streams, entry.streamId); }),
+                owned.entries.end());
+            owned.entries.push_back({ mId, buffer });
+        }
+        tLastStreamId = mId;
+        tLastBuffer = buffer;
+        return buffer;
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Append(LogSeverity severity, const LogSite* site, const char* message, usize length) {
+        PerThreadLogBuffer* buffer = tLastStreamId == mId ? tLastBuffer : AcquireThreadBuffer();
+        if (!buffer) {
+            mReleasedDrops.fetch_add(1, eastl::memory_order_relaxed);
+            return;
+        }
+        const usize capacity = buffer->capacity;
+        // keeps a single record from taking more than a quarter of the ring
+        length = eastl::min(length, capacity / 4 - sizeof(PerThreadLogRecord) - 1);
+        const usize size = RecordSize(length);
+
+        u64 head = buffer->head.load(eastl::memory_order_relaxed);
+        for (;;) {
+            const usize offset = head & (capacity - 1);
+            const usize contiguous = capacity - offset;
+            const usize needed = size <= contiguous ? size : contiguous + size;
+            if (head + needed - buffer->cachedTail > capacity) {
+                buffer->cachedTail = buffer->tail.load(eastl::memory_order_acquire);
+            }
+            if (head + needed - buffer->cachedTail <= capacity) {
+                if (size > contiguous) {
+                    // records don't wrap, the rest of the ring is skipped
+                    if (contiguous >= sizeof(PerThreadLogRecord)) {
+                        reinterpret_cast<PerThreadLogRecord*>(buffer->data + offset)->length = PerThreadLogRecord::PADDING;
+                    }
+                    head += contiguous;
+                }
+                break;
+            }
+            WakeCollector();
+            if (mPolicy != LogOverflowPolicy::Block) {
+                // only this thread writes the counter
+                buffer->dropped.store(buffer->dropped.load(eastl::memory_order_relaxed) + 1, eastl::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        u8* slot = buffer->data + (head & (capacity - 1));
+        auto* record = reinterpret_cast<PerThreadLogRecord*>(slot);
+        record->site = site;
+        record->length = static_cast<u32>(length);
+        record->severity = severity;
+        memcpy(slot + sizeof(PerThreadLogRecord), message, length);
+        slot[sizeof(PerThreadLogRecord) + length] = '\0';
+        // stamped as late as possible, keeps the window in which a later collector pass could overtake it small
+        record->timestamp = internal::ReadTimestampCounter();
+        const u64 newHead = head + size;
+        buffer->head.store(newHead, eastl::memory_order_release);
+
+        // wakes the collector once per crossing of the half-way mark rather than on every message
+        const u64 half = capacity / 2;
+        if (severity >= LogSeverity::Error || (head - buffer->cachedTail <= half && newHead - buffer->cachedTail > half)) {
+            WakeCollector();
+        }
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::WakeCollector() {
+        if (mWakeRequested.load(eastl::memory_order_relaxed) || mWakeRequested.exchange(true, eastl::memory_order_relaxed)) {
+            return;
+        }
+        std::lock_guard lock(mMutex);
+        mWake.notify_one();
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::CollectorThreadMain() {
+        const auto interval = std::chrono::milliseconds(mFlushIntervalMs);
+        std::unique_lock lock(mMutex);
+        for (;;) {
+            mWake.wait_for(lock, interval, [&]() {
+                return mWakeRequested.load(eastl::memory_order_relaxed) || mStopping || mFlushRequested != mFlushCompleted;
+            });
+            mWakeRequested.store(false, eastl::memory_order_relaxed);
+            const u64 flushTarget = mFlushRequested;
+            const bool stopping = mStopping;
+            lock.unlock();
+
+            // producers are gone by the time the stream is destroyed, everything left goes out
+            Collect(stopping ? ~0ull : internal::ReadTimestampCounter());
+
+            lock.lock();
+            mFlushCompleted = flushTarget;
+            mFlushed.notify_all();
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+    PYRO_COMMON_API u32 PerThreadLogStream::Collect(u64 watermark) {
+        eastl::vector<RingCursor> cursors;
+        {
+            std::lock_guard lock(mBuffersMutex);
+            cursors.reserve(mBuffers.size());
+            for (PerThreadLogBuffer* buffer : mBuffers) {
+                cursors.push_back({ buffer, buffer->tail.load(eastl::memory_order_relaxed), 0, nullptr, false });
+            }
+        }
+
+        // k-way merge of the rings by timestamp
+        const auto later = [&](u32 a, u32 b) { return cursors[a].record->timestamp > cursors[b].record->timestamp; };
+        eastl::vector<u32> heap;
+        heap.reserve(cursors.size());
+        for (u32 i = 0; i < cursors.size(); ++i) {
+            RingCursor& cursor = cursors[i];
+            // a thread that exited can't publish anything after this
+            const bool abandoned = cursor.buffer->abandoned.load(eastl::memory_order_acquire);
+            cursor.end = cursor.buffer->head.load(eastl::memory_order_acquire);
+            Advance(cursor, watermark);
+            if (cursor.record) {
+                heap.push_back(i);
+            } else {
+                cursor.release = abandoned && cursor.position == cursor.end;
+            }
+        }
+        eastl::make_heap(heap.begin(), heap.end(), later);
+
+        u32 delivered = 0;
+        while (!heap.empty()) {
+            eastl::pop_heap(heap.begin(), heap.end(), later);
+            const u32 index = heap.back();
+            RingCursor& cursor = cursors[index];
+            const PerThreadLogRecord& record = *cursor.record;
+            Deliver(record.severity, record.site, reinterpret_cast<const char*>(&record + 1), record.length);
+            ++delivered;
+            cursor.position += RecordSize(record.length);
+            Advance(cursor, watermark);
+            if (cursor.record) {
+                eastl::push_heap(heap.begin(), heap.end(), later);
+            } else {
+                heap.pop_back();
+            }
+        }
+
+        bool released = false;
+        for (RingCursor& cursor : cursors) {
+            // hands the space back to the producer
+            cursor.buffer->tail.store(cursor.position, eastl::memory_order_release);
+            if (mPolicy == LogOverflowPolicy::DropAndReport) {
+                const u64 dropped = cursor.buffer->dropped.load(eastl::memory_order_relaxed);
+                if (dropped != cursor.buffer->reportedDrops) {
+                    auto report = fmt::format("[PerThreadLogStream] Thread buffer full, dropped {} messages", dropped - cursor.buffer->reportedDrops);
+                    Deliver(LogSeverity::Warn, nullptr, report.c_str(), report.size());
+                    cursor.buffer->reportedDrops = dropped;
+                }
+            }
+            released |= cursor.release;
+        }
+        if (released) {
+            std::lock_guard lock(mBuffersMutex);
+            for (const RingCursor& cursor : cursors) {
+                if (!cursor.release) {
+                    continue;
+                }
+                mReleasedDrops.fetch_add(cursor.buffer->dropped.load(eastl::memory_order_relaxed), eastl::memory_order_relaxed);
+                mBuffers.erase(eastl::find(mBuffers.begin(), mBuffers.end(), cursor.buffer));
+                delete[] cursor.buffer->data;
+                delete cursor.buffer;
+            }
+        }
+        return delivered;
+    }
+
+    PYRO_COMMON_API void PerThreadLogStream::Deliver(LogSeverity severity, const LogSite* site, const char* message, usize length) {
+        for (ILogStream* sink : mSinks) {
+            if (severity < sink->MinSeverity()) {
+                continue;
+            }
+            if (site) {
+                sink->Log(*site, message, length);
+            } else {
+                sink->Log(severity, message, length);
+            }
+        }
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,152 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Logging/AsyncLogStream.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(PYRO_PLATFORM_X86_64) || defined(PYRO_PLATFORM_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace PyroshockStudios {
+    namespace internal {
+        /// Cheap monotonic timestamp that is consistent across cores: the invariant TSC on x86,
+        /// the virtual counter on ARM64, the steady clock elsewhere. Only meant for ordering.
+        PYRO_NODISCARD PYRO_FORCEINLINE u64 ReadTimestampCounter() noexcept {
+#if defined(PYRO_PLATFORM_X86_64) || defined(PYRO_PLATFORM_X86)
+            return __rdtsc();
+#elif defined(PYRO_PLATFORM_ARM64) && !defined(_MSC_VER)
+            u64 counter;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(counter));
+            return counter;
+#else
+            return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        struct PerThreadLogRecord {
+            static constexpr u32 PADDING = ~0u;
+
+            u64 timestamp;
+            // Set for messages logged through the PYRO_LOG_* macros
+            const LogSite* site;
+            // Of the message without its terminator, PADDING skips to the start of the ring
+            u32 length;
+            LogSeverity severity;
+        };
+
+        // Single-producer single-consumer byte ring of one thread. The producer and the collector
+        // each write their own cache line, records never wrap around the end of the ring.
+        struct PerThreadLogBuffer {
+            alignas(64) eastl::atomic<u64> head = 0;
+            // Producer-only copy of tail, refreshed when the ring looks full
+            u64 cachedTail = 0;
+            eastl::atomic<u64> dropped = 0;
+            alignas(64) eastl::atomic<u64> tail = 0;
+            u64 reportedDrops = 0;
+            // Set when the thread exits, the collector frees the buffer once it's drained
+            eastl::atomic<bool> abandoned = false;
+            u8* data = nullptr;
+            usize capacity = 0;
+        };
+    } // namespace internal
+
+    // ILogStream where every thread appends to a ring of its own, so producers never share a cache line.
+    // Records are stamped with internal::ReadTimestampCounter() and a collector thread merges the rings in
+    // timestamp order into the sinks every `flushIntervalMs`. Records stamped after the collector started a
+    // pass wait for the next one, so the order is exact unless a thread is preempted between stamping a
+    // record and publishing it. The sinks are only ever called from the collector and must outlive the stream.
+    class PerThreadLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        static constexpr u32 DEFAULT_BUFFER_SIZE = 64 * 1024;
+        static constexpr u32 DEFAULT_FLUSH_INTERVAL_MS = 5;
+
+        /// `bufferSize` is the size in bytes of each thread's ring and is rounded up to a power of two.
+        PYRO_COMMON_API explicit PerThreadLogStream(eastl::span<ILogStream* const> sinks, u32 bufferSize = DEFAULT_BUFFER_SIZE,
+            LogOverflowPolicy policy = LogOverflowPolicy::Block, u32 flushIntervalMs = DEFAULT_FLUSH_INTERVAL_MS);
+        /// Delivers everything still buffered before returning.
+        PYRO_COMMON_API ~PerThreadLogStream();
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_COMMON_API void Log(const LogSite& site, const char* message, usize length) override;
+        PYRO_NODISCARD LogSeverity MinSeverity() const override { return mMinSeverity; }
+        PYRO_NODISCARD const char* Name() const override { return "PerThreadLogStream"; }
+
+        /// Blocks until every message logged before the call has been handed to the sinks.
+        PYRO_COMMON_API void Flush();
+
+        /// Messages discarded because a thread's ring was full, counted under every policy.
+        /// Also counts messages logged by a thread after its rings were handed back on exit.
+        PYRO_NODISCARD PYRO_COMMON_API u64 DroppedCount() const;
+        /// Threads that currently own a ring.
+        PYRO_NODISCARD PYRO_COMMON_API u32 BufferCount() const;
+
+    private:
+        // Slow path of finding the calling thread's ring, creates it on the first message of the thread.
+        // Null once the thread is exiting and its rings were handed back.
+        PYRO_NODISCARD PYRO_COMMON_API internal::PerThreadLogBuffer* AcquireThreadBuffer();
+        PYRO_COMMON_API void Append(LogSeverity severity, const LogSite* site, const char* message, usize length);
+        PYRO_COMMON_API void WakeCollector();
+        PYRO_COMMON_API void CollectorThreadMain();
+        /// Delivers every published record stamped up to `watermark`, returns how many.
+        PYRO_COMMON_API u32 Collect(u64 watermark);
+        PYRO_COMMON_API void Deliver(LogSeverity severity, const LogSite* site, const char* message, usize length);
+
+        u64 mId;
+        usize mBufferSize;
+        LogOverflowPolicy mPolicy;
+        LogSeverity mMinSeverity = LogSeverity::Fatal;
+        u32 mFlushIntervalMs;
+        eastl::vector<ILogStream*> mSinks = {};
+
+        // Guards the set of rings, producers only take it once per thread
+        mutable std::mutex mBuffersMutex = {};
+        eastl::vector<internal::PerThreadLogBuffer*> mBuffers = {};
+        // Drops of the rings of threads that exited, and of messages logged after that
+        eastl::atomic<u64> mReleasedDrops = 0;
+
+        // Rarely written by producers, on Error and Fatal messages or when a ring fills up
+        alignas(64) eastl::atomic<bool> mWakeRequested = false;
+        std::mutex mMutex = {};
+        std::condition_variable mWake = {};
+        std::condition_variable mFlushed = {};
+        bool mStopping = false;
+        u64 mFlushRequested = 0;
+        u64 mFlushCompleted = 0;
+        std::thread mCollectorThread = {};
+    };
+} // namespace PyroshockStudios
@@ -0,0 +1,268 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "RotatingFileLogStream.hpp"
+#include "LogSuppression.hpp"
+
+#include <EASTL/algorithm.h>
+#include <chrono>
+#include <fmt/format.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    namespace {
+        constexpr const char* SEVERITY_NAMES[] = { "Verbose", "Debug", "Trace", "Info", "Warn", "Error", "Fatal" };
+        // "YYYY-MM-DD HH:MM:SS"
+        constexpr usize SECOND_PREFIX_LENGTH = 19;
+
+        struct UtcTime {
+            i32 year;
+            u32 month;
+            u32 day;
+            u32 hour;
+            u32 minute;
+            u32 second;
+        };
+
+        UtcTime ToUtcTime(std::chrono::sys_seconds time) {
+            const auto days = std::chrono::floor<std::chrono::days>(time);
+            const std::chrono::year_month_day date(days);
+            const std::chrono::hh_mm_ss clock(time - days);
+            return {
+                static_cast<i32>(date.year()),
+                static_cast<u32>(date.month()),
+                static_cast<u32>(date.day()),
+                static_cast<u32>(clock.hours().count()),
+                static_cast<u32>(clock.minutes().count()),
+                static_cast<u32>(clock.seconds().count()),
+            };
+        }
+
+        // Appends "YYYY-MM-DD HH:MM:SS.mmm", the part up to the second is cached per thread
+        void AppendTimestamp(fmt::memory_buffer& out, std::chrono::system_clock::time_point now) {
+            thread_local i64 tCachedSecond = -1;
+            thread_local char tCachedPrefix[SECOND_PREFIX_LENGTH + 1] = {};
+
+            const auto second = std::chrono::floor<std::chrono::seconds>(now);
+            if (second.time_since_epoch().count() != tCachedSecond) {
+                const UtcTime time = ToUtcTime(second);
+                fmt::format_to_n(tCachedPrefix, SECOND_PREFIX_LENGTH, "{:04}-{:02}-{:02} {:02}:{:02}:{:02}", time.year, time.month, time.day,
+                    time.hour, time.minute, time.second);
+                tCachedSecond = second.time_since_epoch().count();
+            }
+            out.append(tCachedPrefix, tCachedPrefix + SECOND_PREFIX_LENGTH);
+            const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now - second).count();
+            fmt::format_to(fmt::appender(out), ".{:03}", millis);
+        }
+
+        i64 NowNanoseconds() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    } // namespace
+
+    PYRO_COMMON_API RotatingFileLogStream::RotatingFileLogStream(const RotatingFileLogConfig& config) : mConfig(config) {
+        mConfig.blockSize = eastl::max<usize>(mConfig.blockSize, 4096);
+        mConfig.maxPendingBlocks = eastl::max(mConfig.maxPendingBlocks, 1u);
+        mActive.data.reserve(mConfig.blockSize);
+        OpenSegment();
+        mWriterThread = std::thread([this] { WriterThreadMain(); });
+    }
+
+    PYRO_COMMON_API RotatingFileLogStream::~RotatingFileLogStream() {
+        LogSuppression::RemoveStream(this);
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mWake.notify_one();
+        mWriterThread.join();
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::Log(LogSeverity severity, const char* message) {
+        Log(severity, message, strlen(message));
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::Log(LogSeverity severity, const char* message, usize length) {
+        if (severity < mConfig.minSeverity) {
+            return;
+        }
+        // the line is put together before taking the lock
+        fmt::memory_buffer line;
+        AppendTimestamp(line, std::chrono::system_clock::now());
+        fmt::format_to(fmt::appender(line), " [{}] ", SEVERITY_NAMES[static_cast<u32>(severity)]);
+        line.append(message, message + length);
+        line.push_back('\n');
+
+        bool wake = false;
+        {
+            std::lock_guard lock(mMutex);
+            if (!mActive.data.empty() && mActive.data.size() + line.size() > mConfig.blockSize) {
+                if (mPending.size() >= mConfig.maxPendingBlocks) {
+                    mDropped.fetch_add(1, eastl::memory_order_relaxed);
+                    return;
+                }
+                mPending.push_back(eastl::move(mActive));
+                if (!mFree.empty()) {
+                    mActive = eastl::move(mFree.back());
+                    mFree.pop_back();
+                } else {
+                    mActive = {};
+                    mActive.data.reserve(mConfig.blockSize);
+                }
+                wake = true;
+            }
+            mActive.data.insert(mActive.data.end(), line.begin(), line.end());
+            ++mActive.messages;
+            if (severity >= LogSeverity::Error) {
+                mUrgent = true;
+                wake = true;
+            }
+        }
+        if (wake) {
+            mWake.notify_one();
+        }
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::Flush() {
+        LogSuppression::FlushPending(this);
+        std::unique_lock lock(mMutex);
+        const u64 target = ++mFlushRequested;
+        mWake.notify_one();
+        mFlushed.wait(lock, [&] { return mFlushCompleted >= target; });
+    }
+
+    PYRO_COMMON_API eastl::vector<eastl::string> RotatingFileLogStream::Segments() const {
+        std::lock_guard lock(mMutex);
+        return eastl::vector<eastl::string>(mSegments.begin(), mSegments.end());
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::WriterThreadMain() {
+        const auto flushInterval = std::chrono::milliseconds(eastl::max(mConfig.flushIntervalMs, 1u));
+        eastl::vector<Block> blocks;
+        std::unique_lock lock(mMutex);
+        while (true) {
+            const bool woken = mWake.wait_for(lock, flushInterval, [&] {
+                return !mPending.empty() || mUrgent || mStopping || mFlushRequested != mFlushCompleted;
+            });
+            const u64 flushTarget = mFlushRequested;
+            const bool stopping = mStopping;
+
+            blocks.swap(mPending);
+            // full blocks wake the thread on their own, the partial one only goes out when something asks for it
+            const bool takeActive = !woken || mUrgent || stopping || flushTarget != mFlushCompleted;
+            if (takeActive && !mActive.data.empty()) {
+                blocks.push_back(eastl::move(mActive));
+                if (!mFree.empty()) {
+                    mActive = eastl::move(mFree.back());
+                    mFree.pop_back();
+                } else {
+                    mActive = {};
+                    mActive.data.reserve(mConfig.blockSize);
+                }
+            }
+            mUrgent = false;
+
+            lock.unlock();
+            for (const Block& block : blocks) {
+                WriteBlock(block);
+            }
+            lock.lock();
+
+            for (Block& block : blocks) {
+                block.data.clear();
+                block.messages = 0;
+                mFree.push_back(eastl::move(block));
+            }
+            blocks.clear();
+            mFlushCompleted = flushTarget;
+            mFlushed.notify_all();
+            if (stopping && mPending.empty() && mActive.data.empty()) {
+                break;
+            }
+        }
+        lock.unlock();
+        CloseSegment();
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::WriteBlock(const Block& block) {
+        const bool tooLarge = mSegmentSize + block.data.size() > mConfig.maxSegmentSize;
+        const bool tooOld = mConfig.maxSegmentSeconds != 0 &&
+                            NowNanoseconds() - mSegmentOpened >= static_cast<i64>(mConfig.maxSegmentSeconds) * 1'000'000'000;
+        if (mSegmentSize != 0 && (tooLarge || tooOld)) {
+            OpenSegment();
+        } else if (!mFile && NowNanoseconds() - mSegmentOpened >= static_cast<i64>(mConfig.reopenIntervalMs) * 1'000'000) {
+            OpenSegment();
+        }
+        if (!mFile) {
+            mDropped.fetch_add(block.messages, eastl::memory_order_relaxed);
+            return;
+        }
+        const usize written = mFile->Write(block.data.data(), block.data.size());
+        mSegmentSize += written;
+        if (written != block.data.size()) {
+            mFailed.store(true, eastl::memory_order_relaxed);
+        }
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::OpenSegment() {
+        CloseSegment();
+        const UtcTime time = ToUtcTime(std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()));
+        fmt::memory_buffer path;
+        fmt::format_to(fmt::appender(path), "{}-{:04}{:02}{:02}-{:02}{:02}{:02}-{}.log", mConfig.basePath.c_str(), time.year, time.month,
+            time.day, time.hour, time.minute, time.second, mSegmentIndex++);
+        eastl::string segment(path.data(), path.size());
+
+        mFile = eastl::make_unique<FileStream>(segment, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+        mSegmentOpened = NowNanoseconds();
+        if (!mFile->IsOpen()) {
+            mFile.reset();
+            mFailed.store(true, eastl::memory_order_relaxed);
+            return;
+        }
+        // best effort, writes work without it
+        (void)mFile->Preallocate(mConfig.maxSegmentSize);
+
+        eastl::vector<eastl::string> expired;
+        {
+            std::lock_guard lock(mMutex);
+            mSegments.push_back(eastl::move(segment));
+            while (mConfig.maxSegments != 0 && mSegments.size() > mConfig.maxSegments) {
+                expired.push_back(eastl::move(mSegments.front()));
+                mSegments.pop_front();
+            }
+        }
+        for (const eastl::string& old : expired) {
+            remove(old.c_str());
+        }
+    }
+
+    PYRO_COMMON_API void RotatingFileLogStream::CloseSegment() {
+        if (!mFile) {
+            return;
+        }
+        // gives back the preallocated space past what was written
+        (void)mFile->Resize(mSegmentSize);
+        mFile.reset();
+        mSegmentSize = 0;
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,119 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/atomic.h>
+#include <EASTL/deque.h>
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace PyroshockStudios {
+    struct RotatingFileLogConfig {
+        // Segments are named <basePath>-<YYYYMMDD>-<HHMMSS>-<index>.log, with the UTC time they were opened
+        eastl::string basePath = {};
+        // A new segment is started before a block would take the current one past this size
+        usize maxSegmentSize = 64 * 1024 * 1024;
+        // A new segment is started once the current one is this old, 0 only rotates by size
+        u32 maxSegmentSeconds = 0;
+        // The oldest segments written by this stream are deleted past this count, 0 keeps them all
+        u32 maxSegments = 10;
+        // Messages are gathered into blocks of this size and written one block per call
+        usize blockSize = 256 * 1024;
+        // Filled blocks waiting for the writer thread, messages are dropped rather than wait for it
+        u32 maxPendingBlocks = 16;
+        // Partially filled blocks are written after at most this long, Error and Fatal messages right away
+        u32 flushIntervalMs = 1000;
+        // After a segment failed to open, another one is tried at most this often, blocks in between are dropped
+        u32 reopenIntervalMs = 1000;
+        LogSeverity minSeverity = LogSeverity::Verbose;
+    };
+
+    // ILogStream that writes timestamped lines into a series of rotated files.
+    // Producers only copy the line into the current block under a short lock, a writer thread owns the files:
+    // it writes whole blocks through FileStream, preallocates each segment and rotates by size or age.
+    class RotatingFileLogStream final : public ILogStream, DeleteCopy, DeleteMove {
+    public:
+        PYRO_COMMON_API explicit RotatingFileLogStream(const RotatingFileLogConfig& config);
+        /// Writes everything still buffered before returning.
+        PYRO_COMMON_API ~RotatingFileLogStream();
+
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message) override;
+        PYRO_COMMON_API void Log(LogSeverity severity, const char* message, usize length) override;
+        PYRO_NODISCARD LogSeverity MinSeverity() const override { return mConfig.minSeverity; }
+        PYRO_NODISCARD const char* Name() const override { return "RotatingFileLogStream"; }
+
+        /// Blocks until every message logged before the call has been written to the current segment.
+        PYRO_COMMON_API void Flush();
+
+        /// Messages discarded because the writer thread fell maxPendingBlocks behind or no segment was open.
+        PYRO_NODISCARD u64 DroppedCount() const noexcept { return mDropped.load(eastl::memory_order_relaxed); }
+        /// False once a segment couldn't be opened or a write came up short.
+        PYRO_NODISCARD bool IsGood() const noexcept { return !mFailed.load(eastl::memory_order_relaxed); }
+        /// Paths of the segments still on disk, oldest first.
+        PYRO_NODISCARD PYRO_COMMON_API eastl::vector<eastl::string> Segments() const;
+
+    private:
+        struct Block {
+            eastl::vector<char> data = {};
+            // messages may span several lines, counted for DroppedCount
+            u32 messages = 0;
+        };
+
+        // All called on the writer thread
+        PYRO_COMMON_API void WriterThreadMain();
+        PYRO_COMMON_API void WriteBlock(const Block& block);
+        PYRO_COMMON_API void OpenSegment();
+        PYRO_COMMON_API void CloseSegment();
+
+        RotatingFileLogConfig mConfig;
+        eastl::atomic<u64> mDropped = 0;
+        eastl::atomic<bool> mFailed = false;
+
+        // Guards everything below up to the writer state
+        mutable std::mutex mMutex = {};
+        std::condition_variable mWake = {};
+        std::condition_variable mFlushed = {};
+        Block mActive = {};
+        eastl::vector<Block> mPending = {};
+        eastl::vector<Block> mFree = {};
+        bool mUrgent = false;
+        bool mStopping = false;
+        u64 mFlushRequested = 0;
+        u64 mFlushCompleted = 0;
+        eastl::deque<eastl::string> mSegments = {};
+
+        // Writer thread state
+        eastl::unique_ptr<FileStream> mFile = {};
+        usize mSegmentSize = 0;
+        i64 mSegmentOpened = 0;
+        u32 mSegmentIndex = 0;
+        std::thread mWriterThread = {};
+    };
+} // namespace PyroshockStudios
@@ -0,0 +1,393 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "Memory.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace PyroshockStudios {
+    namespace internal {
+        struct BiasedRefOwner {
+            eastl::atomic<const BiasedRefCounted*> queue = { nullptr };
+            BiasedRefOwner* nextClosed = nullptr;
+
+            // Merges every object of a queue that was detached from an owner
+            static void Drain(const BiasedRefCounted* head) {
+                while (head) {
+                    // merging may delete the object
+                    const BiasedRefCounted* next = head->mNextQueued;
+                    head->MergeQueued();
+                    head = next;
+                }
+            }
+        };
+    } // namespace internal
+
+    namespace {
+        // Queue head of an owner whose thread has exited, objects queued afterwards are merged by the releasing thread
+        const BiasedRefCounted* const BIASED_QUEUE_CLOSED = reinterpret_cast<const BiasedRefCounted*>(uptr(1));
+
+        // Owners of exited threads. They are never freed, objects created on a thread keep pointing at its owner
+        // for as long as they live.
+        eastl::atomic<internal::BiasedRefOwner*> gClosedBiasedRefOwners = { nullptr };
+
+        // Closes the owner's queue when the thread exits
+        struct BiasedRefOwnerCloser {
+            internal::BiasedRefOwner* owner = nullptr;
+            ~BiasedRefOwnerCloser();
+        };
+
+        thread_local bool tBiasedRefOwnerClosed = false;
+        thread_local BiasedRefOwnerCloser tBiasedRefOwnerCloser;
+
+        BiasedRefOwnerCloser::~BiasedRefOwnerCloser() {
+            // thread_locals of a translation unit may be set up together, so this can run on threads without an owner
+            tBiasedRefOwnerClosed = true;
+            if (!owner) {
+                return;
+            }
+            // from here on this thread uses the shared count even for objects it owns, which keeps the biased counts
+            // stable for the threads that merge them after the queue is closed
+            internal::tBiasedRefOwner = nullptr;
+            internal::BiasedRefOwner::Drain(owner->queue.exchange(BIASED_QUEUE_CLOSED, eastl::memory_order_acq_rel));
+
+            owner->nextClosed = gClosedBiasedRefOwners.load(eastl::memory_order_relaxed);
+            while (!gClosedBiasedRefOwners.compare_exchange_weak(owner->nextClosed, owner, eastl::memory_order_release, eastl::memory_order_relaxed)) {
+            }
+        }
+    } // namespace
+
+    PYRO_COMMON_API bool internal::WeakControlBlock::TryAddRef() noexcept {
+        Lock();
+        bool acquired = false;
+        // the object can't be destroyed while the lock is held
+        if (const WeakRefCounted* target = object.load(eastl::memory_order_relaxed)) {
+            u32 count = target->mReferences.load(eastl::memory_order_relaxed);
+            while (count != 0 && !target->mReferences.compare_exchange_weak(count, count + 1, eastl::memory_order_relaxed)) {
+            }
+            acquired = count != 0;
+        }
+        Unlock();
+        return acquired;
+    }
+
+    PYRO_COMMON_API void internal::WeakControlBlock::Lock() noexcept {
+        while (locked.exchange(true, eastl::memory_order_acquire)) {
+            while (locked.load(eastl::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    PYRO_COMMON_API internal::WeakControlBlock* WeakRefCounted::GetWeakControlBlock() const {
+        internal::WeakControlBlock* block = mWeakBlock.load(eastl::memory_order_acquire);
+        if (block) {
+            return block;
+        }
+        internal::WeakControlBlock* created = new internal::WeakControlBlock();
+        created->object.store(this, eastl::memory_order_relaxed);
+        if (mWeakBlock.compare_exchange_strong(block, created, eastl::memory_order_acq_rel, eastl::memory_order_acquire)) {
+            return created;
+        }
+        // another thread created one first
+        delete created;
+        return block;
+    }
+
+    PYRO_COMMON_API void WeakRefCounted::Destroy() const noexcept {
+        // no strong references are left, so no new block can be created at this point
+        if (internal::WeakControlBlock* block = mWeakBlock.load(eastl::memory_order_acquire)) {
+            block->Lock();
+            block->object.store(nullptr, eastl::memory_order_release);
+            block->Unlock();
+            block->ReleaseWeakRef();
+        }
+        delete this;
+    }
+
+    PYRO_COMMON_API BasicRefCounted<RefCountPolicy::Biased>::BasicRefCounted() noexcept {
+        internal::BiasedRefOwner* owner = internal::tBiasedRefOwner;
+        if (!owner) {
+            if (tBiasedRefOwnerClosed) {
+                mShared.store(SHARED_MERGED, eastl::memory_order_relaxed);
+                return;
+            }
+            owner = new internal::BiasedRefOwner();
+            internal::tBiasedRefOwner = owner;
+            tBiasedRefOwnerCloser.owner = owner;
+        } else if (owner->queue.load(eastl::memory_order_relaxed)) {
+            ProcessMergeQueue();
+        }
+        mOwner = owner;
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::ProcessMergeQueue() noexcept {
+        if (internal::BiasedRefOwner* owner = internal::tBiasedRefOwner) {
+            internal::BiasedRefOwner::Drain(owner->queue.exchange(nullptr, eastl::memory_order_acq_rel));
+        }
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::AddRefShared() const noexcept {
+        i64 current = mShared.load(eastl::memory_order_relaxed);
+        i64 desired;
+        do {
+            desired = current + SHARED_ONE;
+            // the owner may never take a reference itself and so never merge, it's asked to on the first one taken elsewhere
+            if (!(current & (SHARED_MERGED | SHARED_QUEUED))) {
+                desired |= SHARED_QUEUED;
+            }
+        } while (!mShared.compare_exchange_weak(current, desired, eastl::memory_order_relaxed, eastl::memory_order_relaxed));
+
+        if ((desired & SHARED_QUEUED) && !(current & SHARED_QUEUED)) {
+            Enqueue();
+        }
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::ReleaseShared() const noexcept {
+        i64 current = mShared.load(eastl::memory_order_relaxed);
+        i64 desired;
+        do {
+            desired = current - SHARED_ONE;
+            // the owner still holds the references that balance this one out
+            if ((desired >> 2) < 0 && !(current & (SHARED_MERGED | SHARED_QUEUED))) {
+                desired |= SHARED_QUEUED;
+            }
+        } while (!mShared.compare_exchange_weak(current, desired, eastl::memory_order_acq_rel, eastl::memory_order_relaxed));
+
+        if ((desired & SHARED_QUEUED) && !(current & SHARED_QUEUED)) {
+            Enqueue();
+            return;
+        }
+        // queued objects are reclaimed by the merge
+        if ((desired & (SHARED_MERGED | SHARED_QUEUED)) == SHARED_MERGED && (desired >> 2) == 0) {
+            delete this;
+        }
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::Enqueue() const noexcept {
+        // acquire pairs with the owner closing the queue, MergeQueued reads its final mBiased
+        const BasicRefCounted* head = mOwner->queue.load(eastl::memory_order_acquire);
+        do {
+            if (head == BIASED_QUEUE_CLOSED) {
+                MergeQueued();
+                return;
+            }
+            mNextQueued = head;
+        } while (!mOwner->queue.compare_exchange_weak(head, this, eastl::memory_order_acq_rel, eastl::memory_order_acquire));
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::MergeBiased() const noexcept {
+        i64 previous = mShared.fetch_or(SHARED_MERGED, eastl::memory_order_acq_rel);
+        if (previous & SHARED_QUEUED) {
+            // queued on this thread by its first shared reference, merging now lets the last shared release reclaim it
+            ProcessMergeQueue();
+            return;
+        }
+        if ((previous >> 2) == 0) {
+            delete this;
+        }
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Biased>::MergeQueued() const noexcept {
+        i64 biased = static_cast<i64>(mBiased);
+        mBiased = 0;
+        i64 current = mShared.load(eastl::memory_order_relaxed);
+        i64 desired;
+        do {
+            desired = (((current >> 2) + biased) * SHARED_ONE) | SHARED_MERGED;
+        } while (!mShared.compare_exchange_weak(current, desired, eastl::memory_order_acq_rel, eastl::memory_order_relaxed));
+
+        if ((desired >> 2) == 0) {
+            delete this;
+        }
+    }
+
+    namespace internal {
+        struct DeferredReleaseList {
+            eastl::atomic<const DeferredRefCounted*> head = { nullptr };
+            // Lists of exited threads are handed to new threads
+            eastl::atomic<bool> inUse = { true };
+            // Registry link, set once when the list is registered
+            DeferredReleaseList* next = nullptr;
+        };
+    } // namespace internal
+
+    namespace {
+        struct DeferredReleaseRegistry {
+            std::mutex mutex;
+            eastl::atomic<internal::DeferredReleaseList*> lists = { nullptr };
+
+            std::mutex reclaimThreadMutex;
+            std::condition_variable reclaimThreadWake;
+            std::thread reclaimThread;
+            bool stopReclaimThread = false;
+        };
+
+        // Intentionally leaked, objects may still be released during static destruction
+        DeferredReleaseRegistry& DeferredRegistry() {
+            static DeferredReleaseRegistry* registry = new DeferredReleaseRegistry();
+            return *registry;
+        }
+
+        enum class DeferredListState : u8 {
+            // No list yet, the exit flusher isn't registered
+            Fresh,
+            Active,
+            // The thread is exiting, objects are destroyed right away
+            Bypass
+        };
+
+        // Destroys what is left on the thread's list when it exits. Kept separate from the list pointer so that
+        // stays usable during thread teardown.
+        struct DeferredListFlusher {
+            bool registered = false;
+            ~DeferredListFlusher();
+        };
+
+        thread_local internal::DeferredReleaseList* tDeferredList = nullptr;
+        thread_local DeferredListState tDeferredListState = DeferredListState::Fresh;
+        thread_local DeferredListFlusher tDeferredListFlusher;
+
+        internal::DeferredReleaseList* AcquireDeferredList() {
+            DeferredReleaseRegistry& registry = DeferredRegistry();
+            std::lock_guard lock(registry.mutex);
+            for (internal::DeferredReleaseList* list = registry.lists.load(eastl::memory_order_relaxed); list; list = list->next) {
+                bool inUse = false;
+                if (list->inUse.compare_exchange_strong(inUse, true, eastl::memory_order_acquire)) {
+                    return list;
+                }
+            }
+            internal::DeferredReleaseList* list = new internal::DeferredReleaseList();
+            list->next = registry.lists.load(eastl::memory_order_relaxed);
+            registry.lists.store(list, eastl::memory_order_release);
+            return list;
+        }
+
+        void PushDeferredChain(internal::DeferredReleaseList& list, const DeferredRefCounted* first, const DeferredRefCounted*& lastNext) {
+            const DeferredRefCounted* head = list.head.load(eastl::memory_order_relaxed);
+            do {
+                lastNext = head;
+            } while (!list.head.compare_exchange_weak(head, first, eastl::memory_order_release, eastl::memory_order_relaxed));
+        }
+
+        DeferredListFlusher::~DeferredListFlusher() {
+            tDeferredListState = DeferredListState::Bypass;
+            // may run on threads that never released a deferred object, see BiasedRefOwnerCloser
+            if (!tDeferredList) {
+                return;
+            }
+            DeferredRefCounted::Reclaim();
+            tDeferredList->inUse.store(false, eastl::memory_order_release);
+            tDeferredList = nullptr;
+        }
+    } // namespace
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Deferred>::Retire() const noexcept {
+        internal::DeferredReleaseList* list = tDeferredList;
+        if (!list) {
+            if (tDeferredListState == DeferredListState::Bypass) {
+                delete this;
+                return;
+            }
+            list = AcquireDeferredList();
+            tDeferredList = list;
+            tDeferredListState = DeferredListState::Active;
+            // touching the thread_local registers its destructor for this thread
+            tDeferredListFlusher.registered = true;
+        }
+        PushDeferredChain(*list, this, mNextDeferred);
+    }
+
+    usize BasicRefCounted<RefCountPolicy::Deferred>::DestroyList(internal::DeferredReleaseList& list, usize maxObjects) noexcept {
+        usize destroyed = 0;
+        while (destroyed < maxObjects) {
+            const BasicRefCounted* node = list.head.exchange(nullptr, eastl::memory_order_acquire);
+            if (!node) {
+                break;
+            }
+            while (node && destroyed < maxObjects) {
+                const BasicRefCounted* next = node->mNextDeferred;
+                delete node;
+                ++destroyed;
+                node = next;
+            }
+            if (node) {
+                // out of budget, put the rest back
+                const BasicRefCounted* last = node;
+                while (last->mNextDeferred) {
+                    last = last->mNextDeferred;
+                }
+                PushDeferredChain(list, node, last->mNextDeferred);
+            }
+        }
+        return destroyed;
+    }
+
+    PYRO_COMMON_API usize BasicRefCounted<RefCountPolicy::Deferred>::Reclaim(usize maxObjects) noexcept {
+        internal::DeferredReleaseList* list = tDeferredList;
+        return list ? DestroyList(*list, maxObjects) : 0;
+    }
+
+    PYRO_COMMON_API usize BasicRefCounted<RefCountPolicy::Deferred>::ReclaimAll() noexcept {
+        usize destroyed = 0;
+        // lists are never unregistered, so the chain can be walked without the registry lock
+        for (internal::DeferredReleaseList* list = DeferredRegistry().lists.load(eastl::memory_order_acquire); list; list = list->next) {
+            destroyed += DestroyList(*list, ~usize(0));
+        }
+        // objects released by the destructors that just ran
+        return destroyed + Reclaim();
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Deferred>::StartReclaimThread(u32 intervalMilliseconds) {
+        DeferredReleaseRegistry& registry = DeferredRegistry();
+        std::lock_guard lock(registry.reclaimThreadMutex);
+        if (registry.reclaimThread.joinable()) {
+            return;
+        }
+        registry.stopReclaimThread = false;
+        registry.reclaimThread = std::thread([&registry, intervalMilliseconds]() {
+            std::unique_lock lock(registry.reclaimThreadMutex);
+            while (!registry.stopReclaimThread) {
+                registry.reclaimThreadWake.wait_for(lock, std::chrono::milliseconds(intervalMilliseconds));
+                lock.unlock();
+                ReclaimAll();
+                lock.lock();
+            }
+        });
+    }
+
+    PYRO_COMMON_API void BasicRefCounted<RefCountPolicy::Deferred>::StopReclaimThread() {
+        DeferredReleaseRegistry& registry = DeferredRegistry();
+        std::thread reclaimThread;
+        {
+            std::lock_guard lock(registry.reclaimThreadMutex);
+            registry.stopReclaimThread = true;
+            reclaimThread = eastl::move(registry.reclaimThread);
+        }
+        registry.reclaimThreadWake.notify_all();
+        if (reclaimThread.joinable()) {
+            reclaimThread.join();
+        }
+    }
+} // namespace PyroshockStudios
@@ -26,13 +26,34 @@
 #include <EASTL/atomic.h>
 
 namespace PyroshockStudios {
-    // Base class for intrusive ref-counting
-    class RefCounted {
+    enum class RefCountPolicy : u8 {
+        // Atomic count, objects can be shared between any threads
+        Atomic,
+        // Plain count, objects must never be referenced from more than one thread
+        NonAtomic,
+        // The creating thread counts with plain arithmetic, other threads use an atomic shared count.
+        // Cheap for objects that mostly stay on their owner thread but occasionally cross over.
+        Biased,
+        // Atomic count, but objects are queued when their count drops to zero and destroyed later in batches,
+        // keeping long destructor chains off latency-critical threads
+        Deferred
+    };
+
+    // Base class for intrusive ref-counting, use through RefCounted or the LocalRefCounted, BiasedRefCounted and DeferredRefCounted aliases
+    template <RefCountPolicy Policy>
+    class BasicRefCounted;
+
+    template <>
+    class BasicRefCounted<RefCountPolicy::Atomic> {
     public:
         void AddRef() const noexcept {
             mReferences.fetch_add(1, eastl::memory_order_relaxed);
         }
 
+        void AddRef(u32 count) const noexcept {
+            mReferences.fetch_add(count, eastl::memory_order_relaxed);
+        }
+
         void Release() const noexcept {
             if (mReferences.fetch_sub(1, eastl::memory_order_acq_rel) == 1) {
                 delete this;
@@ -40,10 +61,239 @@ namespace PyroshockStudios {
         }
 
     protected:
-        virtual ~RefCounted() = default;
+        virtual ~BasicRefCounted() = default;
+
+    private:
+        mutable eastl::atomic<u32> mReferences = { 0 };
+    };
+
+    template <>
+    class BasicRefCounted<RefCountPolicy::NonAtomic> {
+    public:
+        void AddRef() const noexcept {
+            ++mReferences;
+        }
+
+        void Release() const noexcept {
+            if (--mReferences == 0) {
+                delete this;
+            }
+        }
+
+    protected:
+        BasicRefCounted() = default;
+        BasicRefCounted(const BasicRefCounted&) = delete;
+        BasicRefCounted& operator=(const BasicRefCounted&) = delete;
+        virtual ~BasicRefCounted() = default;
+
+    private:
+        mutable u32 mReferences = 0;
+    };
+
+    namespace internal {
+        // Per-thread queue of biased objects whose shared count went negative and need their counts merged
+        struct BiasedRefOwner;
+        inline thread_local BiasedRefOwner* tBiasedRefOwner = nullptr;
+    } // namespace internal
+
+    // Biased reference counting: the total count is the owner's biased count plus the shared count.
+    // When the owner's count drops to zero the two are merged and every thread uses the shared count from then on.
+    // A release on another thread can take the shared count below zero while the owner still holds the balancing
+    // references, and an object the owner never references itself would never be merged. Such objects are queued on the
+    // owner, at the first shared reference or when the shared count goes negative, and merged in ProcessMergeQueue,
+    // which runs whenever the owner creates a biased object. Threads that rarely create objects should call it periodically, otherwise objects
+    // released elsewhere are only reclaimed when the owner exits.
+    template <>
+    class BasicRefCounted<RefCountPolicy::Biased> {
+    public:
+        void AddRef() const noexcept {
+            if (mOwner == internal::tBiasedRefOwner && (mBiased > 0 || !(mShared.load(eastl::memory_order_relaxed) & SHARED_MERGED))) {
+                ++mBiased;
+                return;
+            }
+            // once merged or queued an object stays that way
+            if (mShared.load(eastl::memory_order_relaxed) & (SHARED_MERGED | SHARED_QUEUED)) {
+                mShared.fetch_add(SHARED_ONE, eastl::memory_order_relaxed);
+                return;
+            }
+            AddRefShared();
+        }
+
+        void Release() const noexcept {
+            if (mOwner == internal::tBiasedRefOwner && mBiased > 0) {
+                if (--mBiased == 0) {
+                    MergeBiased();
+                }
+                return;
+            }
+            ReleaseShared();
+        }
+
+        /// Merges the objects other threads queued on the calling thread, reclaiming those without references.
+        PYRO_COMMON_API static void ProcessMergeQueue() noexcept;
+
+    protected:
+        PYRO_COMMON_API BasicRefCounted() noexcept;
+        BasicRefCounted(const BasicRefCounted&) = delete;
+        BasicRefCounted& operator=(const BasicRefCounted&) = delete;
+        virtual ~BasicRefCounted() = default;
+
+    private:
+        friend struct internal::BiasedRefOwner;
+
+        // The shared count is stored shifted left by two, the low bits hold the state flags
+        static constexpr i64 SHARED_MERGED = 1;
+        static constexpr i64 SHARED_QUEUED = 2;
+        static constexpr i64 SHARED_ONE = 4;
+
+        PYRO_COMMON_API void AddRefShared() const noexcept;
+        PYRO_COMMON_API void ReleaseShared() const noexcept;
+        PYRO_COMMON_API void Enqueue() const noexcept;
+        PYRO_COMMON_API void MergeBiased() const noexcept;
+        PYRO_COMMON_API void MergeQueued() const noexcept;
+
+        // Null for objects created while their thread was exiting. Those start out merged with a biased count
+        // of zero, so matching a thread without an owner still takes the shared path.
+        internal::BiasedRefOwner* mOwner = nullptr;
+        mutable u32 mBiased = 0;
+        mutable eastl::atomic<i64> mShared = { 0 };
+        // Link in the owner's merge queue, an object is queued at most once
+        mutable const BasicRefCounted* mNextQueued = nullptr;
+    };
+
+    namespace internal {
+        // Per-thread list of deferred objects waiting to be destroyed
+        struct DeferredReleaseList;
+    } // namespace internal
+
+    // Objects are pushed onto a lock-free list of the thread that released the last reference. Lists are drained
+    // by Reclaim on the owning thread, by ReclaimAll from any thread, by the optional reclaim thread,
+    // and when their thread exits.
+    template <>
+    class BasicRefCounted<RefCountPolicy::Deferred> {
+    public:
+        void AddRef() const noexcept {
+            mReferences.fetch_add(1, eastl::memory_order_relaxed);
+        }
+
+        void AddRef(u32 count) const noexcept {
+            mReferences.fetch_add(count, eastl::memory_order_relaxed);
+        }
+
+        void Release() const noexcept {
+            if (mReferences.fetch_sub(1, eastl::memory_order_acq_rel) == 1) {
+                Retire();
+            }
+        }
+
+        /// Destroys up to `maxObjects` objects released on the calling thread, including the ones released
+        /// by the destructors it runs. Lets a frame or request spread a large teardown over several reclaim points.
+        /// @return The number of objects destroyed.
+        PYRO_COMMON_API static usize Reclaim(usize maxObjects = ~usize(0)) noexcept;
+
+        /// Destroys the objects released on every thread.
+        /// @return The number of objects destroyed.
+        PYRO_COMMON_API static usize ReclaimAll() noexcept;
+
+        /// Starts a background thread that runs ReclaimAll every `intervalMilliseconds`.
+        PYRO_COMMON_API static void StartReclaimThread(u32 intervalMilliseconds = 10);
+        /// Stops the background thread, objects it didn't get to stay queued for the next ReclaimAll.
+        PYRO_COMMON_API static void StopReclaimThread();
+
+    protected:
+        BasicRefCounted() = default;
+        BasicRefCounted(const BasicRefCounted&) = delete;
+        BasicRefCounted& operator=(const BasicRefCounted&) = delete;
+        virtual ~BasicRefCounted() = default;
+
+    private:
+        PYRO_COMMON_API void Retire() const noexcept;
+        static usize DestroyList(internal::DeferredReleaseList& list, usize maxObjects) noexcept;
+
+        mutable eastl::atomic<u32> mReferences = { 0 };
+        // Link in the list the object is queued on
+        mutable const BasicRefCounted* mNextDeferred = nullptr;
+    };
+
+    // Kept a distinct class rather than an alias so existing forward declarations keep working
+    class RefCounted : public BasicRefCounted<RefCountPolicy::Atomic> {
+    protected:
+        ~RefCounted() override = default;
+    };
+
+    using LocalRefCounted = BasicRefCounted<RefCountPolicy::NonAtomic>;
+    using BiasedRefCounted = BasicRefCounted<RefCountPolicy::Biased>;
+    using DeferredRefCounted = BasicRefCounted<RefCountPolicy::Deferred>;
+
+    class WeakRefCounted;
+
+    namespace internal {
+        // Shared between an object and its WeakRefs, outlives the object until the last WeakRef is gone
+        struct WeakControlBlock {
+            // One per WeakRef, plus one held by the object while it is alive
+            eastl::atomic<u32> weakReferences = { 1 };
+            eastl::atomic<bool> locked = { false };
+            // Cleared under the lock before the object is destroyed
+            eastl::atomic<const WeakRefCounted*> object = { nullptr };
+
+            void AddWeakRef() noexcept {
+                weakReferences.fetch_add(1, eastl::memory_order_relaxed);
+            }
+
+            void ReleaseWeakRef() noexcept {
+                if (weakReferences.fetch_sub(1, eastl::memory_order_acq_rel) == 1) {
+                    delete this;
+                }
+            }
+
+            PYRO_NODISCARD bool IsExpired() const noexcept {
+                return object.load(eastl::memory_order_acquire) == nullptr;
+            }
+
+            // Adds a strong reference unless the object's count already reached zero
+            PYRO_NODISCARD PYRO_COMMON_API bool TryAddRef() noexcept;
+
+            PYRO_COMMON_API void Lock() noexcept;
+            void Unlock() noexcept {
+                locked.store(false, eastl::memory_order_release);
+            }
+        };
+    } // namespace internal
+
+    // Atomic ref-counting base for objects that can be observed through WeakRef.
+    // Costs one pointer per object over RefCounted, the control block is only allocated when the first WeakRef is taken.
+    class WeakRefCounted {
+    public:
+        void AddRef() const noexcept {
+            mReferences.fetch_add(1, eastl::memory_order_relaxed);
+        }
+
+        void AddRef(u32 count) const noexcept {
+            mReferences.fetch_add(count, eastl::memory_order_relaxed);
+        }
+
+        void Release() const noexcept {
+            if (mReferences.fetch_sub(1, eastl::memory_order_acq_rel) == 1) {
+                Destroy();
+            }
+        }
+
+        /// Returns the control block, creating it if needed. The caller must hold a strong reference.
+        PYRO_NODISCARD PYRO_COMMON_API internal::WeakControlBlock* GetWeakControlBlock() const;
+
+    protected:
+        WeakRefCounted() = default;
+        WeakRefCounted(const WeakRefCounted&) = delete;
+        WeakRefCounted& operator=(const WeakRefCounted&) = delete;
+        virtual ~WeakRefCounted() = default;
 
     private:
+        friend struct internal::WeakControlBlock;
+
+        PYRO_COMMON_API void Destroy() const noexcept;
+
         mutable eastl::atomic<u32> mReferences = { 0 };
+        mutable eastl::atomic<internal::WeakControlBlock*> mWeakBlock = { nullptr };
     };
 
     template <typename T>
@@ -144,12 +394,26 @@ namespace PyroshockStudios {
         PYRO_NODISCARD PYRO_FORCEINLINE bool operator==(const SharedRef&) const = default;
         PYRO_NODISCARD PYRO_FORCEINLINE bool operator!=(const SharedRef&) const = default;
 
-        // Factory helper
+        // Factory helper. Types deriving from PoolAllocated are allocated from the ObjectPool.
         template <typename... Args>
         PYRO_NODISCARD PYRO_FORCEINLINE static SharedRef<T> Create(Args&&... args) {
             return SharedRef<T>(new T(eastl::forward<Args>(args)...));
         }
 
+        // Takes over a reference the caller already holds, without adding one
+        PYRO_NODISCARD PYRO_FORCEINLINE static SharedRef<T> Adopt(T* ptr) noexcept {
+            SharedRef<T> ref;
+            ref.mPtr = ptr;
+            return ref;
+        }
+
+        // Gives up the reference without releasing it, the caller becomes responsible for it
+        PYRO_NODISCARD PYRO_FORCEINLINE T* Detach() noexcept {
+            T* ptr = mPtr;
+            mPtr = nullptr;
+            return ptr;
+        }
+
         // Give access to other template instantiations
         template <typename U>
         friend class SharedRef;
@@ -162,4 +426,90 @@ namespace PyroshockStudios {
         }
     };
 
+    // Non-owning reference to a WeakRefCounted object. Lock() returns a SharedRef, or null once the object is gone.
+    template <typename T>
+    class WeakRef {
+        internal::WeakControlBlock* mBlock = nullptr;
+        // Only dereferenced after Lock() secured a strong reference
+        T* mPtr = nullptr;
+
+        template <typename U>
+        friend class WeakRef;
+
+    public:
+        WeakRef() = default;
+        WeakRef(std::nullptr_t) {}
+
+        template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        WeakRef(const SharedRef<U>& ref) : mPtr(ref.Get()) {
+            if (mPtr) {
+                mBlock = mPtr->GetWeakControlBlock();
+                mBlock->AddWeakRef();
+            }
+        }
+
+        WeakRef(const WeakRef& other) : mBlock(other.mBlock), mPtr(other.mPtr) {
+            if (mBlock)
+                mBlock->AddWeakRef();
+        }
+
+        WeakRef(WeakRef&& other) noexcept : mBlock(other.mBlock), mPtr(other.mPtr) {
+            other.mBlock = nullptr;
+            other.mPtr = nullptr;
+        }
+
+        template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        WeakRef(const WeakRef<U>& other) : mBlock(other.mBlock), mPtr(other.mPtr) {
+            if (mBlock)
+                mBlock->AddWeakRef();
+        }
+
+        ~WeakRef() {
+            if (mBlock)
+                mBlock->ReleaseWeakRef();
+        }
+
+        WeakRef& operator=(const WeakRef& other) {
+            if (this != &other) {
+                if (other.mBlock)
+                    other.mBlock->AddWeakRef();
+                if (mBlock)
+                    mBlock->ReleaseWeakRef();
+                mBlock = other.mBlock;
+                mPtr = other.mPtr;
+            }
+            return *this;
+        }
+
+        WeakRef& operator=(WeakRef&& other) noexcept {
+            if (this != &other) {
+                if (mBlock)
+                    mBlock->ReleaseWeakRef();
+                mBlock = other.mBlock;
+                mPtr = other.mPtr;
+                other.mBlock = nullptr;
+                other.mPtr = nullptr;
+            }
+            return *this;
+        }
+
+        PYRO_NODISCARD SharedRef<T> Lock() const noexcept {
+            if (mBlock && mBlock->TryAddRef()) {
+                return SharedRef<T>::Adopt(mPtr);
+            }
+            return nullptr;
+        }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE bool Expired() const noexcept {
+            return !mBlock || mBlock->IsExpired();
+        }
+
+        void Reset() noexcept {
+            if (mBlock)
+                mBlock->ReleaseWeakRef();
+            mBlock = nullptr;
+            mPtr = nullptr;
+        }
+    };
+
 } // namespace PyroshockStudios
@@ -24,6 +24,180 @@
 
 #ifdef PYRO_IMPLEMENT_NEW_OPERATOR
 
+#if defined(PYRO_COMMON_USE_SNMALLOC) || defined(PYRO_COMMON_USE_SLAB_ALLOCATOR) || defined(PYRO_COMMON_TRACK_ALLOCATIONS)
+#include <new>
+
+#if defined(PYRO_COMMON_USE_SNMALLOC)
+#include <snmalloc/snmalloc.h>
+#elif defined(PYRO_COMMON_USE_SLAB_ALLOCATOR)
+#include <PyroCommon/SlabAllocator.hpp>
+#else
+#include <stdlib.h>
+#endif
+
+#ifdef PYRO_COMMON_TRACK_ALLOCATIONS
+#include <PyroCommon/AllocationTracker.hpp>
+#include <string.h>
+#endif
+
+namespace PyroshockStudios::internal {
+#ifdef PYRO_COMMON_TRACK_ALLOCATIONS
+    PYRO_FORCEINLINE void* overload_raw_malloc(usize size) {
+#if defined(PYRO_COMMON_USE_SNMALLOC)
+        return snmalloc::libc::malloc(size);
+#elif defined(PYRO_COMMON_USE_SLAB_ALLOCATOR)
+        return SlabAllocator::Allocate(size);
+#else
+        return malloc(size);
+#endif
+    }
+
+    PYRO_FORCEINLINE void overload_raw_free(void* ptr) {
+#if defined(PYRO_COMMON_USE_SNMALLOC)
+        snmalloc::libc::free(ptr);
+#elif defined(PYRO_COMMON_USE_SLAB_ALLOCATOR)
+        SlabAllocator::Deallocate(ptr);
+#else
+        free(ptr);
+#endif
+    }
+
+    // Sits right in front of every tracked allocation, so the free can be attributed
+    // to the same tag and the start of the underlying block can be recovered
+    struct overload_tracking_header {
+        u32 baseOffset;
+        u16 tag;
+        u16 reserved;
+        u64 size;
+    };
+    static_assert(sizeof(overload_tracking_header) == 16);
+
+    // Returns a block where (ptr + offset) is aligned to `alignment`.
+    PYRO_FORCEINLINE void* overload_allocate(usize size, usize alignment, usize offset, const char* tagName) {
+        if (alignment < alignof(std::max_align_t)) {
+            alignment = alignof(std::max_align_t);
+        }
+        offset &= alignment - 1;
+        u8* base = static_cast<u8*>(overload_raw_malloc(size + sizeof(overload_tracking_header) + alignment - 1));
+        if (!base) {
+            return nullptr;
+        }
+        uptr first = reinterpret_cast<uptr>(base) + sizeof(overload_tracking_header);
+        u8* ptr = reinterpret_cast<u8*>(PYRO_ALIGN(first + offset, alignment) - offset);
+
+        overload_tracking_header header = {};
+        header.baseOffset = static_cast<u32>(ptr - base);
+        header.tag = AllocationTracker::TagFromName(tagName);
+        header.size = size;
+        // the header is only guaranteed to be aligned when there is no offset
+        memcpy(ptr - sizeof(overload_tracking_header), &header, sizeof(header));
+
+        AllocationTracker::OnAllocate(header.tag, size);
+        return ptr;
+    }
+
+    PYRO_FORCEINLINE void overload_free(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        u8* bytes = static_cast<u8*>(ptr);
+        overload_tracking_header header;
+        memcpy(&header, bytes - sizeof(overload_tracking_header), sizeof(header));
+        AllocationTracker::OnDeallocate(header.tag, static_cast<usize>(header.size));
+        overload_raw_free(bytes - header.baseOffset);
+    }
+#elif defined(PYRO_COMMON_USE_SLAB_ALLOCATOR)
+    // Returns a block where (ptr + offset) is aligned to `alignment`.
+    PYRO_FORCEINLINE void* overload_allocate(usize size, usize alignment, usize offset, const char*) {
+        return SlabAllocator::Allocate(size, alignment, offset);
+    }
+
+    PYRO_FORCEINLINE void overload_free(void* ptr) {
+        SlabAllocator::Deallocate(ptr);
+    }
+#else
+    // Returns a block where (ptr + offset) is aligned to `alignment`.
+    // A non-zero offset is served by over-allocating and handing out an interior pointer,
+    // which is why deallocation always resolves the start of the snmalloc object first.
+    PYRO_FORCEINLINE void* overload_allocate(usize size, usize alignment, usize offset, const char*) {
+        if (alignment < alignof(std::max_align_t)) {
+            alignment = alignof(std::max_align_t);
+        }
+        offset &= alignment - 1;
+        if (offset == 0) {
+            return alignment == alignof(std::max_align_t) ? snmalloc::libc::malloc(size) : snmalloc::libc::aligned_alloc(alignment, size);
+        }
+        u8* base = static_cast<u8*>(snmalloc::libc::aligned_alloc(alignment, size + alignment));
+        if (!base) {
+            return nullptr;
+        }
+        return base + (alignment - offset);
+    }
+
+    PYRO_FORCEINLINE void overload_free(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        snmalloc::libc::free(snmalloc::libc::__malloc_start_pointer(ptr));
+    }
+#endif
+
+    PYRO_FORCEINLINE void* overload_allocate_or_throw(usize size, usize alignment, usize offset, const char* tagName) {
+        void* ptr = overload_allocate(size, alignment, offset, tagName);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+} // namespace PyroshockStudios::internal
+
+// EASTL frees everything it gets from the hooks below with delete[], so the whole array
+// new/delete family has to be routed through the same backend. Scalar new/delete is untouched.
+
+void* PYRO_CDECL operator new[](std::size_t size) {
+    return PyroshockStudios::internal::overload_allocate_or_throw(size, 0, 0, nullptr);
+}
+void* PYRO_CDECL operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return PyroshockStudios::internal::overload_allocate(size, 0, 0, nullptr);
+}
+void* PYRO_CDECL operator new[](std::size_t size, std::align_val_t alignment) {
+    return PyroshockStudios::internal::overload_allocate_or_throw(size, static_cast<std::size_t>(alignment), 0, nullptr);
+}
+void* PYRO_CDECL operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return PyroshockStudios::internal::overload_allocate(size, static_cast<std::size_t>(alignment), 0, nullptr);
+}
+
+void PYRO_CDECL operator delete[](void* ptr) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+void PYRO_CDECL operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+void PYRO_CDECL operator delete[](void* ptr, std::size_t) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+void PYRO_CDECL operator delete[](void* ptr, std::align_val_t) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+void PYRO_CDECL operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+void PYRO_CDECL operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    PyroshockStudios::internal::overload_free(ptr);
+}
+
+// The allocation name is used as the tracking tag, falling back to the source file when EASTL
+// is configured to pass file/line but no name.
+void* PYRO_CDECL operator new[](PyroshockStudios::usize size, const char* name, int flags, PyroshockStudios::u32 debugFlags, const char* file, int line) {
+    return PyroshockStudios::internal::overload_allocate_or_throw(size, 0, 0, name ? name : file);
+}
+
+void* PYRO_CDECL operator new[](PyroshockStudios::usize size, PyroshockStudios::usize alignment, PyroshockStudios::usize offset, const char* name, int flags, PyroshockStudios::u32 debugFlags, const char* file, int line) {
+    return PyroshockStudios::internal::overload_allocate_or_throw(size, alignment, offset, name ? name : file);
+}
+
+#else
+
 void* PYRO_CDECL operator new[](PyroshockStudios::usize size, const char* name, int flags, PyroshockStudios::u32 debugFlags, const char* file, int line) {
     return new PyroshockStudios::u8[size];
 }
@@ -32,4 +206,6 @@ void* PYRO_CDECL operator new[](PyroshockStudios::usize size, PyroshockStudios::
     return new PyroshockStudios::u8[size];
 }
 
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,203 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ObjectPool.hpp"
+
+#include <EASTL/algorithm.h>
+#include <libassert/assert.hpp>
+#include <mutex>
+
+namespace PyroshockStudios {
+    namespace {
+        constexpr usize POOL_SLAB_SIZE = 64 * 1024;
+        // Blocks moved between a thread cache and the shared list at once
+        constexpr u32 POOL_TRANSFER_BATCH = 32;
+        constexpr u32 POOL_THREAD_CACHE_LIMIT = POOL_TRANSFER_BATCH * 2;
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        struct SizeClassPool {
+            std::mutex mutex;
+            FreeBlock* freeList = nullptr;
+            u8* slabCursor = nullptr;
+            u8* slabEnd = nullptr;
+        };
+
+        struct ThreadCacheBin {
+            FreeBlock* head = nullptr;
+            u32 count = 0;
+        };
+
+        enum class ThreadCacheState : u8 {
+            // Nothing cached yet, the exit flusher isn't registered
+            Fresh,
+            Active,
+            // The thread is exiting, blocks go straight to the shared lists
+            Bypass
+        };
+
+        struct ThreadCache {
+            ThreadCacheBin bins[ObjectPool::SIZE_CLASS_COUNT];
+            ThreadCacheState state = ThreadCacheState::Fresh;
+        };
+
+        // Flushes the thread cache when the thread exits. Kept separate from ThreadCache so the cache
+        // itself stays trivially destructible and remains usable during thread teardown.
+        struct ThreadCacheFlusher {
+            bool registered = false;
+            ~ThreadCacheFlusher();
+        };
+
+        thread_local ThreadCache tCache;
+        thread_local ThreadCacheFlusher tCacheFlusher;
+
+        // Intentionally leaked, objects may still be released during static destruction
+        SizeClassPool* SizeClassPools() {
+            static SizeClassPool* pools = new SizeClassPool[ObjectPool::SIZE_CLASS_COUNT];
+            return pools;
+        }
+
+        PYRO_FORCEINLINE usize SizeClassIndex(usize size) {
+            return (eastl::max<usize>(size, 1) - 1) / ObjectPool::SIZE_CLASS_GRANULARITY;
+        }
+
+        PYRO_FORCEINLINE usize SizeClassBlockSize(usize index) {
+            return (index + 1) * ObjectPool::SIZE_CLASS_GRANULARITY;
+        }
+
+        // Moves up to `count` blocks from the shared pool into `bin`, carving a new slab if needed
+        void RefillBin(usize index, ThreadCacheBin& bin, u32 count) {
+            SizeClassPool& pool = SizeClassPools()[index];
+            usize blockSize = SizeClassBlockSize(index);
+
+            std::lock_guard lock(pool.mutex);
+            while (bin.count < count) {
+                FreeBlock* block = pool.freeList;
+                if (block) {
+                    pool.freeList = block->next;
+                } else {
+                    if (pool.slabCursor == pool.slabEnd) {
+                        pool.slabCursor = static_cast<u8*>(::operator new(POOL_SLAB_SIZE));
+                        pool.slabEnd = pool.slabCursor + (POOL_SLAB_SIZE / blockSize) * blockSize;
+                    }
+                    block = reinterpret_cast<FreeBlock*>(pool.slabCursor);
+                    pool.slabCursor += blockSize;
+                }
+                block->next = bin.head;
+                bin.head = block;
+                ++bin.count;
+            }
+        }
+
+        // Returns `count` blocks from the front of `bin` to the shared pool
+        void DrainBin(usize index, ThreadCacheBin& bin, u32 count) {
+            if (count == 0) {
+                return;
+            }
+            FreeBlock* first = bin.head;
+            FreeBlock* last = first;
+            for (u32 i = 1; i < count; ++i) {
+                last = last->next;
+            }
+            bin.head = last->next;
+            bin.count -= count;
+
+            SizeClassPool& pool = SizeClassPools()[index];
+            std::lock_guard lock(pool.mutex);
+            last->next = pool.freeList;
+            pool.freeList = first;
+        }
+
+        ThreadCacheFlusher::~ThreadCacheFlusher() {
+            ObjectPool::FlushThreadCache();
+            tCache.state = ThreadCacheState::Bypass;
+        }
+
+        // Touching the thread_local registers its destructor for this thread
+        PYRO_FORCEINLINE void ActivateThreadCache() {
+            tCacheFlusher.registered = true;
+            tCache.state = ThreadCacheState::Active;
+        }
+    } // namespace
+
+    PYRO_COMMON_API void* ObjectPool::Allocate(usize size) {
+        if (size > MAX_BLOCK_SIZE) {
+            return ::operator new(size);
+        }
+        usize index = SizeClassIndex(size);
+        ThreadCacheBin& bin = tCache.bins[index];
+        if (!bin.head) {
+            if (tCache.state == ThreadCacheState::Bypass) {
+                ThreadCacheBin single = {};
+                RefillBin(index, single, 1);
+                return single.head;
+            }
+            if (tCache.state == ThreadCacheState::Fresh) {
+                ActivateThreadCache();
+            }
+            RefillBin(index, bin, POOL_TRANSFER_BATCH);
+        }
+        FreeBlock* block = bin.head;
+        bin.head = block->next;
+        --bin.count;
+        return block;
+    }
+
+    PYRO_COMMON_API void ObjectPool::Deallocate(void* ptr, usize size) noexcept {
+        if (!ptr) {
+            return;
+        }
+        if (size > MAX_BLOCK_SIZE) {
+            ::operator delete(ptr);
+            return;
+        }
+        usize index = SizeClassIndex(size);
+        ThreadCacheBin& bin = tCache.bins[index];
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = bin.head;
+        bin.head = block;
+        ++bin.count;
+        if (bin.count > POOL_THREAD_CACHE_LIMIT || tCache.state != ThreadCacheState::Active) {
+            switch (tCache.state) {
+            case ThreadCacheState::Fresh:
+                ActivateThreadCache();
+                break;
+            case ThreadCacheState::Bypass:
+                DrainBin(index, bin, bin.count);
+                return;
+            default:
+                break;
+            }
+            if (bin.count > POOL_THREAD_CACHE_LIMIT) {
+                DrainBin(index, bin, POOL_TRANSFER_BATCH);
+            }
+        }
+    }
+
+    PYRO_COMMON_API void ObjectPool::FlushThreadCache() noexcept {
+        for (usize i = 0; i < SIZE_CLASS_COUNT; ++i) {
+            DrainBin(i, tCache.bins[i], tCache.bins[i].count);
+        }
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+
+#include <new>
+
+namespace PyroshockStudios {
+    // Thread-safe pool of fixed-size blocks. Every size class has its own free list, fed from
+    // slabs that are carved lazily and never returned to the heap. Each thread keeps a small cache
+    // per size class and only touches the shared lists in batches.
+    class ObjectPool {
+    public:
+        static constexpr usize SIZE_CLASS_GRANULARITY = 16;
+        static constexpr usize MAX_BLOCK_SIZE = 512;
+        static constexpr usize SIZE_CLASS_COUNT = MAX_BLOCK_SIZE / SIZE_CLASS_GRANULARITY;
+
+        // Sizes above MAX_BLOCK_SIZE are forwarded to the global heap.
+        PYRO_NODISCARD PYRO_COMMON_API static void* Allocate(usize size);
+        // `size` must be the size that was passed to Allocate.
+        PYRO_COMMON_API static void Deallocate(void* ptr, usize size) noexcept;
+
+        // Returns the calling thread's cached blocks to the shared free lists.
+        PYRO_COMMON_API static void FlushThreadCache() noexcept;
+    };
+
+    // Opt-in base that routes `new T` and the final `delete` of the derived type through the ObjectPool.
+    // Combined with RefCounted this keeps SharedRef<T>::Create and the last Release off the global heap:
+    //   class Handle : public RefCounted, public PoolAllocated { ... };
+    struct PoolAllocated {
+        PYRO_FORCEINLINE static void* operator new(usize size) {
+            return ObjectPool::Allocate(size);
+        }
+        PYRO_FORCEINLINE static void operator delete(void* ptr, usize size) noexcept {
+            ObjectPool::Deallocate(ptr, size);
+        }
+
+        // Over-aligned types can't be served from the pool
+        PYRO_FORCEINLINE static void* operator new(usize size, std::align_val_t alignment) {
+            return ::operator new(size, alignment);
+        }
+        PYRO_FORCEINLINE static void operator delete(void* ptr, usize size, std::align_val_t alignment) noexcept {
+            ::operator delete(ptr, size, alignment);
+        }
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
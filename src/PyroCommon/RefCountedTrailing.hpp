@@ -0,0 +1,149 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Memory.hpp>
+
+#include <EASTL/memory.h>
+#include <EASTL/span.h>
+#include <new>
+#include <stdint.h>
+
+namespace PyroshockStudios {
+    // Base for ref-counted objects followed by a variable number of T in the same allocation.
+    // The derived class acts as the header of the trailing elements:
+    //   class StringTable : public RefCountedTrailing<StringTable, char> { ... };
+    //   SharedRef<StringTable> table = StringTable::CreateWithTrailing(byteCount, ctorArgs...);
+    // Allocations are aligned to a cache line. Objects can only be created through CreateWithTrailing.
+    template <typename Derived, typename T, RefCountPolicy Policy = RefCountPolicy::Atomic>
+    class RefCountedTrailing : public BasicRefCounted<Policy> {
+    public:
+        static constexpr usize ALIGNMENT = alignof(T) > 64 ? alignof(T) : 64;
+
+        /// Creates the object with `count` value-initialized trailing elements.
+        template <typename... Args>
+        PYRO_NODISCARD static SharedRef<Derived> CreateWithTrailing(usize count, Args&&... args) {
+            return SharedRef<Derived>(AllocateWithTrailing(
+                count, [](T* first, T* last) { eastl::uninitialized_value_construct(first, last); }, eastl::forward<Args>(args)...));
+        }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE T* TrailingData() noexcept { return mTrailingData; }
+        PYRO_NODISCARD PYRO_FORCEINLINE const T* TrailingData() const noexcept { return mTrailingData; }
+        PYRO_NODISCARD PYRO_FORCEINLINE usize TrailingSize() const noexcept { return mTrailingSize; }
+
+        // Only placement new is allowed, the allocation is owned by CreateWithTrailing and the final Release
+        static void* operator new(usize) = delete;
+        static void* operator new(usize, void* ptr) noexcept { return ptr; }
+        static void operator delete(void* ptr) noexcept {
+            ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+        }
+
+    protected:
+        RefCountedTrailing() = default;
+        ~RefCountedTrailing() override {
+            eastl::destroy(mTrailingData, mTrailingData + mTrailingSize);
+        }
+
+        /// Allocates and constructs the object, then the trailing elements with `construct(first, last)`.
+        /// Anything already built is destroyed and the block freed if a constructor throws, `construct`
+        /// must clean up its own elements like the eastl::uninitialized_* algorithms do.
+        template <typename Construct, typename... Args>
+        PYRO_NODISCARD static Derived* AllocateWithTrailing(usize count, Construct&& construct, Args&&... args) {
+            static_assert(alignof(Derived) <= ALIGNMENT, "Derived type is over-aligned!");
+            if (count > (SIZE_MAX - TrailingOffset()) / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            void* memory = ::operator new(TrailingOffset() + count * sizeof(T), std::align_val_t(ALIGNMENT));
+            Derived* object = nullptr;
+            try {
+                object = new (memory) Derived(eastl::forward<Args>(args)...);
+            } catch (...) {
+                ::operator delete(memory, std::align_val_t(ALIGNMENT));
+                throw;
+            }
+            T* trailing = reinterpret_cast<T*>(static_cast<u8*>(memory) + TrailingOffset());
+            object->mTrailingData = trailing;
+            try {
+                construct(trailing, trailing + count);
+            } catch (...) {
+                // mTrailingSize is still 0, so the base destructor leaves the elements alone
+                object->~Derived();
+                ::operator delete(memory, std::align_val_t(ALIGNMENT));
+                throw;
+            }
+            object->mTrailingSize = count;
+            return object;
+        }
+
+    private:
+        PYRO_NODISCARD PYRO_FORCEINLINE static constexpr usize TrailingOffset() noexcept {
+            return PYRO_ALIGN(sizeof(Derived), alignof(T));
+        }
+
+        // Stored rather than derived from `this`, the base destructor runs after Derived is gone
+        T* mTrailingData = nullptr;
+        usize mTrailingSize = 0;
+    };
+
+    // Fixed-size array that shares one allocation with its reference count, for shared blobs and tables:
+    //   SharedRef<RefCountedArray<u8>> blob = RefCountedArray<u8>::Create(bytes);
+    template <typename T, RefCountPolicy Policy = RefCountPolicy::Atomic>
+    class RefCountedArray final : public RefCountedTrailing<RefCountedArray<T, Policy>, T, Policy> {
+        using Base = RefCountedTrailing<RefCountedArray<T, Policy>, T, Policy>;
+        friend Base;
+
+        RefCountedArray() = default;
+
+    public:
+        /// Creates `count` value-initialized elements.
+        PYRO_NODISCARD static SharedRef<RefCountedArray> Create(usize count) {
+            return Base::CreateWithTrailing(count);
+        }
+
+        /// Creates a copy of `values`.
+        PYRO_NODISCARD static SharedRef<RefCountedArray> Create(eastl::span<const T> values) {
+            return SharedRef<RefCountedArray>(Base::AllocateWithTrailing(
+                values.size(), [&](T* first, T*) { eastl::uninitialized_copy(values.begin(), values.end(), first); }));
+        }
+
+        /// Creates `count` default-initialized elements, which leaves trivial types such as bytes uninitialized.
+        PYRO_NODISCARD static SharedRef<RefCountedArray> CreateUninitialized(usize count) {
+            return SharedRef<RefCountedArray>(Base::AllocateWithTrailing(
+                count, [](T* first, T* last) { eastl::uninitialized_default_construct(first, last); }));
+        }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE T* Data() noexcept { return this->TrailingData(); }
+        PYRO_NODISCARD PYRO_FORCEINLINE const T* Data() const noexcept { return this->TrailingData(); }
+        PYRO_NODISCARD PYRO_FORCEINLINE usize Size() const noexcept { return this->TrailingSize(); }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE T& operator[](usize index) noexcept { return Data()[index]; }
+        PYRO_NODISCARD PYRO_FORCEINLINE const T& operator[](usize index) const noexcept { return Data()[index]; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE T* begin() noexcept { return Data(); }
+        PYRO_NODISCARD PYRO_FORCEINLINE T* end() noexcept { return Data() + Size(); }
+        PYRO_NODISCARD PYRO_FORCEINLINE const T* begin() const noexcept { return Data(); }
+        PYRO_NODISCARD PYRO_FORCEINLINE const T* end() const noexcept { return Data() + Size(); }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE eastl::span<T> Span() noexcept { return { Data(), Size() }; }
+        PYRO_NODISCARD PYRO_FORCEINLINE eastl::span<const T> Span() const noexcept { return { Data(), Size() }; }
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,414 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "SlabAllocator.hpp"
+#include "VirtualMemory.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
+#include <EASTL/atomic.h>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PYRO_COMMON_SLAB_REGION_SIZE
+#if UINTPTR_MAX > 0xFFFFFFFFu
+#define PYRO_COMMON_SLAB_REGION_SIZE (32ull * 1024 * 1024 * 1024)
+#else
+#define PYRO_COMMON_SLAB_REGION_SIZE (256u * 1024 * 1024)
+#endif
+#endif
+
+namespace PyroshockStudios {
+    namespace {
+        constexpr u16 SLAB_CLASS_SIZES[] = {
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256, 320, 384, 448, 512,
+            640, 768, 896, 1024
+        };
+        constexpr usize SLAB_CLASS_COUNT = eastl::size(SLAB_CLASS_SIZES);
+        static_assert(SLAB_CLASS_SIZES[SLAB_CLASS_COUNT - 1] == SlabAllocator::MAX_BLOCK_SIZE);
+
+        // Size class for every multiple of MIN_ALIGNMENT up to MAX_BLOCK_SIZE
+        constexpr auto SLAB_CLASS_LOOKUP = []() {
+            eastl::array<u8, SlabAllocator::MAX_BLOCK_SIZE / SlabAllocator::MIN_ALIGNMENT + 1> lookup = {};
+            usize index = 0;
+            for (usize i = 0; i < lookup.size(); ++i) {
+                while (SLAB_CLASS_SIZES[index] < i * SlabAllocator::MIN_ALIGNMENT) {
+                    ++index;
+                }
+                lookup[i] = static_cast<u8>(index);
+            }
+            return lookup;
+        }();
+
+        constexpr usize SLAB_REGION_SIZE = PYRO_COMMON_SLAB_REGION_SIZE;
+        constexpr usize SLAB_COUNT = SLAB_REGION_SIZE / SlabAllocator::SLAB_SIZE;
+
+        struct Magazine {
+            Magazine* next;
+            u32 count;
+            void* rounds[SlabAllocator::MAGAZINE_CAPACITY];
+        };
+
+        // Shared stock of magazines for one size class, plus the slab that fresh blocks are carved from
+        struct alignas(64) SlabDepot {
+            std::mutex mutex;
+            // Magazines holding at least one block
+            Magazine* full = nullptr;
+            Magazine* empty = nullptr;
+            u8* slabCursor = nullptr;
+            u8* slabEnd = nullptr;
+        };
+
+        struct SlabState {
+            u8* regionBase = nullptr;
+            usize regionSize = 0;
+            // Size class of every slab, indexed by its position in the region
+            u8* slabClasses = nullptr;
+            eastl::atomic<usize> nextSlab = { 0 };
+            SlabDepot depots[SLAB_CLASS_COUNT];
+        };
+
+        // Intentionally leaked, blocks may still be freed during static destruction
+        SlabState& State() {
+            static SlabState* state = []() {
+                SlabState* state = new SlabState();
+                usize metadataSize = PYRO_ALIGN(SLAB_COUNT, VirtualMemory::PageSize());
+                u8* metadata = static_cast<u8*>(VirtualMemory::Reserve(metadataSize));
+                // over-reserve so the region can start on a slab boundary
+                u8* region = static_cast<u8*>(VirtualMemory::Reserve(SLAB_REGION_SIZE + SlabAllocator::SLAB_SIZE));
+                if (metadata && region && VirtualMemory::Commit(metadata, metadataSize)) {
+                    state->slabClasses = metadata;
+                    state->regionBase = reinterpret_cast<u8*>(PYRO_ALIGN(reinterpret_cast<uptr>(region), SlabAllocator::SLAB_SIZE));
+                    state->regionSize = SLAB_REGION_SIZE;
+                } else {
+                    // every allocation falls back to the system heap
+                    VirtualMemory::Release(metadata, metadataSize);
+                    VirtualMemory::Release(region, SLAB_REGION_SIZE + SlabAllocator::SLAB_SIZE);
+                }
+                return state;
+            }();
+            return *state;
+        }
+
+        enum class ThreadCacheState : u8 {
+            // Nothing cached yet, the exit flusher isn't registered
+            Fresh,
+            Active,
+            // The thread is exiting, blocks go straight to the depot
+            Bypass
+        };
+
+        // A class's loaded magazine is used first; previous is kept around so that alternating
+        // allocations and frees at a magazine boundary don't visit the depot every time.
+        struct ThreadMagazines {
+            Magazine* loaded[SLAB_CLASS_COUNT];
+            Magazine* previous[SLAB_CLASS_COUNT];
+            ThreadCacheState state = ThreadCacheState::Fresh;
+        };
+
+        // Flushes the magazines when the thread exits. Kept separate from ThreadMagazines so the cache
+        // itself stays trivially destructible and remains usable during thread teardown.
+        struct ThreadMagazinesFlusher {
+            bool registered = false;
+            ~ThreadMagazinesFlusher();
+        };
+
+        thread_local ThreadMagazines tMagazines = {};
+        thread_local ThreadMagazinesFlusher tMagazinesFlusher;
+
+        ThreadMagazinesFlusher::~ThreadMagazinesFlusher() {
+            SlabAllocator::FlushThreadCache();
+            tMagazines.state = ThreadCacheState::Bypass;
+        }
+
+        // Touching the thread_local registers its destructor for this thread
+        PYRO_FORCEINLINE void ActivateThreadMagazines() {
+            tMagazinesFlusher.registered = true;
+            tMagazines.state = ThreadCacheState::Active;
+        }
+
+        PYRO_FORCEINLINE void PushMagazine(Magazine*& list, Magazine* magazine) {
+            magazine->next = list;
+            list = magazine;
+        }
+
+        PYRO_FORCEINLINE Magazine* PopMagazine(Magazine*& list) {
+            Magazine* magazine = list;
+            if (magazine) {
+                list = magazine->next;
+            }
+            return magazine;
+        }
+
+        // Depot lock must be held
+        Magazine* TakeEmptyMagazine(SlabDepot& depot) {
+            Magazine* magazine = PopMagazine(depot.empty);
+            if (!magazine) {
+                magazine = new (std::nothrow) Magazine;
+                if (!magazine) {
+                    return nullptr;
+                }
+            }
+            magazine->count = 0;
+            return magazine;
+        }
+
+        // Depot lock must be held
+        u8* CarveBlock(usize index, SlabDepot& depot) {
+            usize blockSize = SLAB_CLASS_SIZES[index];
+            if (depot.slabCursor == depot.slabEnd) {
+                SlabState& state = State();
+                usize slab = state.nextSlab.fetch_add(1, eastl::memory_order_relaxed);
+                if (slab >= state.regionSize / SlabAllocator::SLAB_SIZE) {
+                    return nullptr;
+                }
+                u8* base = state.regionBase + slab * SlabAllocator::SLAB_SIZE;
+                if (!VirtualMemory::Commit(base, SlabAllocator::SLAB_SIZE)) {
+                    return nullptr;
+                }
+                state.slabClasses[slab] = static_cast<u8>(index);
+                depot.slabCursor = base;
+                depot.slabEnd = base + (SlabAllocator::SLAB_SIZE / blockSize) * blockSize;
+            }
+            u8* block = depot.slabCursor;
+            depot.slabCursor += blockSize;
+            return block;
+        }
+
+        // Hands a single block back to the depot without going through a thread's magazines
+        void ReturnBlockToDepot(usize index, void* block) {
+            SlabDepot& depot = State().depots[index];
+            std::lock_guard lock(depot.mutex);
+            Magazine* magazine = depot.full;
+            if (!magazine || magazine->count == SlabAllocator::MAGAZINE_CAPACITY) {
+                magazine = TakeEmptyMagazine(depot);
+                if (!magazine) {
+                    // out of memory, the block is lost
+                    return;
+                }
+                PushMagazine(depot.full, magazine);
+            }
+            magazine->rounds[magazine->count++] = block;
+        }
+
+        void* AllocateBlockSlow(usize index) {
+            Magazine*& loaded = tMagazines.loaded[index];
+            Magazine*& previous = tMagazines.previous[index];
+            SlabDepot& depot = State().depots[index];
+
+            if (tMagazines.state == ThreadCacheState::Bypass) {
+                std::lock_guard lock(depot.mutex);
+                Magazine* magazine = depot.full;
+                if (!magazine) {
+                    return CarveBlock(index, depot);
+                }
+                void* block = magazine->rounds[--magazine->count];
+                if (magazine->count == 0) {
+                    PushMagazine(depot.empty, PopMagazine(depot.full));
+                }
+                return block;
+            }
+            if (tMagazines.state == ThreadCacheState::Fresh) {
+                ActivateThreadMagazines();
+            }
+            if (previous && previous->count > 0) {
+                eastl::swap(loaded, previous);
+                return loaded->rounds[--loaded->count];
+            }
+
+            std::lock_guard lock(depot.mutex);
+            // trade the exhausted magazine for a full one, or refill it from the slabs
+            Magazine* full = PopMagazine(depot.full);
+            if (!full) {
+                full = loaded ? eastl::exchange(loaded, nullptr) : TakeEmptyMagazine(depot);
+                if (!full) {
+                    return nullptr;
+                }
+                while (full->count < SlabAllocator::MAGAZINE_CAPACITY) {
+                    u8* block = CarveBlock(index, depot);
+                    if (!block) {
+                        break;
+                    }
+                    full->rounds[full->count++] = block;
+                }
+                if (full->count == 0) {
+                    PushMagazine(depot.empty, full);
+                    return nullptr;
+                }
+            }
+            if (loaded) {
+                PushMagazine(depot.empty, loaded);
+            }
+            loaded = full;
+            return loaded->rounds[--loaded->count];
+        }
+
+        void DeallocateBlockSlow(usize index, void* block) {
+            Magazine*& loaded = tMagazines.loaded[index];
+            Magazine*& previous = tMagazines.previous[index];
+
+            if (tMagazines.state == ThreadCacheState::Bypass) {
+                ReturnBlockToDepot(index, block);
+                return;
+            }
+            if (tMagazines.state == ThreadCacheState::Fresh) {
+                ActivateThreadMagazines();
+            }
+            if (previous && previous->count == 0) {
+                eastl::swap(loaded, previous);
+                loaded->rounds[loaded->count++] = block;
+                return;
+            }
+
+            SlabDepot& depot = State().depots[index];
+            {
+                std::lock_guard lock(depot.mutex);
+                Magazine* empty = TakeEmptyMagazine(depot);
+                if (empty) {
+                    // the full magazine becomes the previous one and the old previous goes to the depot
+                    if (previous) {
+                        PushMagazine(depot.full, previous);
+                    }
+                    previous = loaded;
+                    loaded = empty;
+                    loaded->rounds[loaded->count++] = block;
+                    return;
+                }
+            }
+            ReturnBlockToDepot(index, block);
+        }
+
+        PYRO_FORCEINLINE void* AllocateBlock(usize index) {
+            Magazine* loaded = tMagazines.loaded[index];
+            if (loaded && loaded->count > 0) {
+                return loaded->rounds[--loaded->count];
+            }
+            return AllocateBlockSlow(index);
+        }
+
+        PYRO_FORCEINLINE void DeallocateBlock(usize index, void* block) {
+            Magazine* loaded = tMagazines.loaded[index];
+            if (loaded && loaded->count < SlabAllocator::MAGAZINE_CAPACITY) {
+                loaded->rounds[loaded->count++] = block;
+                return;
+            }
+            DeallocateBlockSlow(index, block);
+        }
+
+        // Sits right in front of every block forwarded to the system heap
+        struct LargeBlockHeader {
+            u64 baseOffset;
+            u64 size;
+        };
+        static_assert(sizeof(LargeBlockHeader) == SlabAllocator::MIN_ALIGNMENT);
+
+        void* AllocateLarge(usize size, usize alignment, usize offset) {
+            u8* base = static_cast<u8*>(malloc(size + sizeof(LargeBlockHeader) + alignment - 1));
+            if (!base) {
+                return nullptr;
+            }
+            uptr first = reinterpret_cast<uptr>(base) + sizeof(LargeBlockHeader);
+            u8* ptr = reinterpret_cast<u8*>(PYRO_ALIGN(first + offset, alignment) - offset);
+            LargeBlockHeader header = { static_cast<u64>(ptr - base), static_cast<u64>(size) };
+            // the header is only guaranteed to be aligned when there is no offset
+            memcpy(ptr - sizeof(LargeBlockHeader), &header, sizeof(header));
+            return ptr;
+        }
+
+        void DeallocateLarge(void* ptr) {
+            u8* bytes = static_cast<u8*>(ptr);
+            LargeBlockHeader header;
+            memcpy(&header, bytes - sizeof(LargeBlockHeader), sizeof(header));
+            free(bytes - header.baseOffset);
+        }
+
+        // Smallest size class of at least `size` bytes whose blocks all start on an `alignment` boundary.
+        // Slabs are aligned to SLAB_SIZE, so that holds for every class whose size is a multiple of `alignment`.
+        PYRO_FORCEINLINE usize FindSizeClass(usize size, usize alignment) {
+            usize index = SLAB_CLASS_LOOKUP[(size + SlabAllocator::MIN_ALIGNMENT - 1) / SlabAllocator::MIN_ALIGNMENT];
+            while (SLAB_CLASS_SIZES[index] & (alignment - 1)) {
+                ++index;
+            }
+            return index;
+        }
+    } // namespace
+
+    PYRO_COMMON_API void* SlabAllocator::Allocate(usize size, usize alignment, usize offset) noexcept {
+        alignment = eastl::max(alignment, MIN_ALIGNMENT);
+        offset &= alignment - 1;
+        // a misaligning offset is served with an interior pointer, Deallocate recovers the block start
+        usize blockSize = offset ? size + alignment : size;
+        if (blockSize <= MAX_BLOCK_SIZE && alignment <= MAX_BLOCK_SIZE) {
+            u8* block = static_cast<u8*>(AllocateBlock(FindSizeClass(blockSize, alignment)));
+            if (block) {
+                return offset ? block + (alignment - offset) : block;
+            }
+        }
+        return AllocateLarge(size, alignment, offset);
+    }
+
+    PYRO_COMMON_API void SlabAllocator::Deallocate(void* ptr) noexcept {
+        if (!ptr) {
+            return;
+        }
+        const SlabState& state = State();
+        uptr position = reinterpret_cast<uptr>(ptr) - reinterpret_cast<uptr>(state.regionBase);
+        if (position >= state.regionSize) {
+            DeallocateLarge(ptr);
+            return;
+        }
+        usize slab = position / SLAB_SIZE;
+        usize index = state.slabClasses[slab];
+        usize blockSize = SLAB_CLASS_SIZES[index];
+        u8* block = state.regionBase + slab * SLAB_SIZE + (position % SLAB_SIZE) / blockSize * blockSize;
+        DeallocateBlock(index, block);
+    }
+
+    PYRO_COMMON_API bool SlabAllocator::Owns(const void* ptr) noexcept {
+        const SlabState& state = State();
+        return reinterpret_cast<uptr>(ptr) - reinterpret_cast<uptr>(state.regionBase) < state.regionSize;
+    }
+
+    PYRO_COMMON_API void SlabAllocator::FlushThreadCache() noexcept {
+        for (usize i = 0; i < SLAB_CLASS_COUNT; ++i) {
+            Magazine*& loaded = tMagazines.loaded[i];
+            Magazine*& previous = tMagazines.previous[i];
+            if (!loaded && !previous) {
+                continue;
+            }
+            SlabDepot& depot = State().depots[i];
+            std::lock_guard lock(depot.mutex);
+            auto returnMagazine = [&depot](Magazine*& magazine) {
+                if (magazine) {
+                    PushMagazine(magazine->count > 0 ? depot.full : depot.empty, magazine);
+                    magazine = nullptr;
+                }
+            };
+            returnMagazine(loaded);
+            returnMagazine(previous);
+        }
+    }
+} // namespace PyroshockStudios
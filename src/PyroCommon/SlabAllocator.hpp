@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Allocator.hpp>
+
+namespace PyroshockStudios {
+    // General purpose allocator for small blocks, usable from any thread.
+    // Blocks are carved from slabs of one reserved address range, so a pointer alone is enough to find its
+    // size class and no per-block header is needed. Each thread keeps two magazines of free blocks per size class
+    // and only visits the shared depot to trade a whole magazine, which keeps frees of blocks allocated on
+    // another thread off the locks in the common case. Slab memory is never returned to the OS.
+    // Larger blocks, and alignments no size class can satisfy, are forwarded to the system heap.
+    class SlabAllocator {
+    public:
+        static constexpr usize MIN_ALIGNMENT = 16;
+        static constexpr usize MAX_BLOCK_SIZE = 1024;
+        static constexpr usize SLAB_SIZE = 64 * 1024;
+        static constexpr u32 MAGAZINE_CAPACITY = 64;
+
+        explicit SlabAllocator(const char* name = "SlabAllocator") : mName(name) {}
+        SlabAllocator(const SlabAllocator& other) = default;
+        SlabAllocator(const SlabAllocator&, const char* name) : mName(name) {}
+        SlabAllocator& operator=(const SlabAllocator& other) = default;
+
+        PYRO_FORCEINLINE void* allocate(usize n, int flags = 0) {
+            return Allocate(n, EASTL_ALLOCATOR_MIN_ALIGNMENT, 0);
+        }
+        PYRO_FORCEINLINE void* allocate(usize n, usize alignment, usize offset, int flags = 0) {
+            return Allocate(n, alignment, offset);
+        }
+        PYRO_FORCEINLINE void deallocate(void* ptr, usize) {
+            Deallocate(ptr);
+        }
+
+        const char* get_name() const { return mName; }
+        void set_name(const char* name) { mName = name; }
+
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator==(const SlabAllocator&) const noexcept { return true; }
+        PYRO_NODISCARD PYRO_FORCEINLINE bool operator!=(const SlabAllocator&) const noexcept { return false; }
+
+        /// Allocates a block such that (ptr + offset) is aligned to `alignment`.
+        /// @return The block, or nullptr if the allocation failed.
+        PYRO_NODISCARD PYRO_COMMON_API static void* Allocate(usize size, usize alignment = MIN_ALIGNMENT, usize offset = 0) noexcept;
+
+        /// Returns a block from Allocate, no matter which thread allocated it.
+        PYRO_COMMON_API static void Deallocate(void* ptr) noexcept;
+
+        /// Whether `ptr` points into a slab, as opposed to a block forwarded to the system heap.
+        PYRO_NODISCARD PYRO_COMMON_API static bool Owns(const void* ptr) noexcept;
+
+        /// Returns the calling thread's magazines to the depot.
+        PYRO_COMMON_API static void FlushThreadCache() noexcept;
+
+    private:
+        const char* mName = nullptr;
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,543 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "AsyncFileIO.hpp"
+
+#include <EASTL/algorithm.h>
+#include <errno.h>
+
+#if defined(PYRO_PLATFORM_LINUX) && __has_include(<linux/io_uring.h>)
+#define PYRO_ASYNC_FILE_IO_URING 1
+#include <atomic>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
+namespace PyroshockStudios {
+    namespace {
+        // FileStream only reports a byte count, the error is picked up from the thread afterwards
+        void ClearLastError() {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+            SetLastError(ERROR_SUCCESS);
+#else
+            errno = 0;
+#endif
+        }
+
+        // 0 when the transfer only came up short at the end of the file
+        i32 LastError() {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+            const DWORD error = GetLastError();
+            return error == ERROR_HANDLE_EOF ? 0 : static_cast<i32>(error);
+#else
+            return errno;
+#endif
+        }
+    } // namespace
+
+#if defined(PYRO_ASYNC_FILE_IO_URING)
+    // The submission and completion rings shared with the kernel, driven with raw syscalls so there is
+    // no liburing dependency
+    struct AsyncFileIO::Ring {
+        int fd = -1;
+        void* sqRing = nullptr;
+        usize sqRingSize = 0;
+        void* cqRing = nullptr;
+        usize cqRingSize = 0;
+        io_uring_sqe* sqes = nullptr;
+        usize sqesSize = 0;
+
+        u32* sqHead = nullptr;
+        u32* sqTail = nullptr;
+        u32* sqArray = nullptr;
+        u32 sqMask = 0;
+        u32 sqEntries = 0;
+        u32* cqHead = nullptr;
+        u32* cqTail = nullptr;
+        u32 cqMask = 0;
+        io_uring_cqe* cqes = nullptr;
+        // pushed to the SQ but not yet passed to io_uring_enter
+        u32 unsubmitted = 0;
+
+        static Ring* Create(u32 entries) {
+            io_uring_params params = {};
+            const int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+            if (fd < 0) {
+                // ENOSYS on old kernels, EPERM where seccomp or a sysctl forbids it
+                return nullptr;
+            }
+            Ring* ring = new Ring{};
+            ring->fd = fd;
+            // IORING_OP_READ and IORING_OP_WRITE came with the same kernel as this flag
+            if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+                delete ring;
+                return nullptr;
+            }
+
+            ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+            ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (singleMap) {
+                ring->sqRingSize = ring->cqRingSize = eastl::max(ring->sqRingSize, ring->cqRingSize);
+            }
+            ring->sqRing = mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+            if (ring->sqRing == MAP_FAILED) {
+                ring->sqRing = nullptr;
+                delete ring;
+                return nullptr;
+            }
+            if (singleMap) {
+                ring->cqRing = ring->sqRing;
+            } else {
+                ring->cqRing = mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+                if (ring->cqRing == MAP_FAILED) {
+                    ring->cqRing = nullptr;
+                    delete ring;
+                    return nullptr;
+                }
+            }
+            ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            void* sqes = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) {
+                delete ring;
+                return nullptr;
+            }
+            ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+            u8* sq = static_cast<u8*>(ring->sqRing);
+            ring->sqHead = reinterpret_cast<u32*>(sq + params.sq_off.head);
+            ring->sqTail = reinterpret_cast<u32*>(sq + params.sq_off.tail);
+            ring->sqArray = reinterpret_cast<u32*>(sq + params.sq_off.array);
+            ring->sqMask = *reinterpret_cast<u32*>(sq + params.sq_off.ring_mask);
+            ring->sqEntries = params.sq_entries;
+            u8* cq = static_cast<u8*>(ring->cqRing);
+            ring->cqHead = reinterpret_cast<u32*>(cq + params.cq_off.head);
+            ring->cqTail = reinterpret_cast<u32*>(cq + params.cq_off.tail);
+            ring->cqMask = *reinterpret_cast<u32*>(cq + params.cq_off.ring_mask);
+            ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            return ring;
+        }
+
+        ~Ring() {
+            if (sqes) {
+                munmap(sqes, sqesSize);
+            }
+            if (cqRing && cqRing != sqRing) {
+                munmap(cqRing, cqRingSize);
+            }
+            if (sqRing) {
+                munmap(sqRing, sqRingSize);
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        // The kernel only reads the SQ tail and writes the SQ head, and the other way around for the CQ
+        io_uring_sqe* NextSqe() {
+            const u32 tail = *sqTail;
+            if (tail - std::atomic_ref<u32>(*sqHead).load(std::memory_order_acquire) == sqEntries) {
+                return nullptr;
+            }
+            io_uring_sqe* sqe = &sqes[tail & sqMask];
+            memset(sqe, 0, sizeof(*sqe));
+            sqArray[tail & sqMask] = tail & sqMask;
+            return sqe;
+        }
+
+        void Push() {
+            std::atomic_ref<u32>(*sqTail).store(*sqTail + 1, std::memory_order_release);
+            ++unsubmitted;
+        }
+
+        // @return 0, or the errno io_uring_enter failed with
+        int Enter(u32 minComplete) {
+            const u32 flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+            const int result = static_cast<int>(syscall(__NR_io_uring_enter, fd, unsubmitted, minComplete, flags, nullptr, 0));
+            if (result < 0) {
+                return errno == EINTR ? 0 : errno;
+            }
+            unsubmitted -= eastl::min(static_cast<u32>(result), unsubmitted);
+            return 0;
+        }
+
+        // EAGAIN when the kernel is short on memory, EBUSY while completions are waiting to be reaped
+        static bool IsTransient(int error) { return error == EAGAIN || error == EBUSY; }
+    };
+#else
+    struct AsyncFileIO::Ring {};
+#endif
+
+    AsyncFileIO::AsyncFileIO(const AsyncFileIOConfig& config)
+        : mConfig(config) {
+        mConfig.queueDepth = eastl::max(mConfig.queueDepth, 1u);
+        mConfig.maxTransferSize = eastl::clamp<usize>(mConfig.maxTransferSize, 1, AsyncFileIOConfig::MAX_TRANSFER_SIZE);
+#if defined(PYRO_ASYNC_FILE_IO_URING)
+        if (!mConfig.forceThreadPool) {
+            mRing = Ring::Create(mConfig.queueDepth);
+        }
+#endif
+        if (!mRing) {
+            const u32 workers = eastl::max(mConfig.workerCount, 1u);
+            mWorkers.reserve(workers);
+            for (u32 i = 0; i < workers; ++i) {
+                mWorkers.emplace_back([this] { WorkerLoop(); });
+            }
+        }
+    }
+
+    AsyncFileIO::~AsyncFileIO() {
+        WaitAll();
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mWorkReady.notify_all();
+        for (std::thread& worker : mWorkers) {
+            worker.join();
+        }
+        delete mRing;
+    }
+
+    bool AsyncFileIO::UsesIoUring() const noexcept {
+        return mRing != nullptr;
+    }
+
+    bool AsyncFileIO::RegisterBuffers(eastl::span<const eastl::span<u8>> buffers) {
+        std::lock_guard lock(mMutex);
+        if (mInFlight.load(eastl::memory_order_relaxed) != 0) {
+            return false;
+        }
+        mBuffers.clear();
+#if defined(PYRO_ASYNC_FILE_IO_URING)
+        if (mRing) {
+            (void)syscall(__NR_io_uring_register, mRing->fd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            if (buffers.empty()) {
+                return true;
+            }
+            eastl::vector<iovec> iovecs;
+            iovecs.reserve(buffers.size());
+            for (const eastl::span<u8>& buffer : buffers) {
+                iovecs.push_back({ buffer.data(), buffer.size() });
+            }
+            if (syscall(__NR_io_uring_register, mRing->fd, IORING_REGISTER_BUFFERS, iovecs.data(), static_cast<u32>(iovecs.size())) != 0) {
+                return false;
+            }
+            mBuffers.assign(buffers.begin(), buffers.end());
+        }
+#endif
+        return true;
+    }
+
+    AsyncFileHandle AsyncFileIO::ReadAsync(FileStream& file, void* out, usize size, u64 offset) {
+        return Enqueue(RequestOp::Read, file, out, size, offset);
+    }
+
+    AsyncFileHandle AsyncFileIO::WriteAsync(FileStream& file, const void* in, usize size, u64 offset) {
+        return Enqueue(RequestOp::Write, file, const_cast<void*>(in), size, offset);
+    }
+
+    AsyncFileHandle AsyncFileIO::Enqueue(RequestOp op, FileStream& file, void* data, usize size, u64 offset) {
+        std::unique_lock lock(mMutex);
+        // bounds what the OS sees at once, the caller can still queue up as much as it likes
+        while (mInFlight.load(eastl::memory_order_relaxed) >= mConfig.queueDepth) {
+            SubmitLocked();
+            WaitForAnyLocked(lock);
+        }
+
+        u32 slot;
+        if (!mFreeSlots.empty()) {
+            slot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        } else {
+            slot = static_cast<u32>(mRequests.size());
+            mRequests.emplace_back();
+        }
+        Request& request = mRequests[slot];
+        request.file = &file;
+        request.data = data;
+        request.size = size;
+        request.offset = offset;
+        request.result = 0;
+        request.error = 0;
+        request.op = op;
+        request.state = RequestState::Queued;
+        request.bufferIndex = -1;
+        const u8* begin = static_cast<const u8*>(data);
+        for (usize i = 0; i < mBuffers.size(); ++i) {
+            if (begin >= mBuffers[i].data() && begin + size <= mBuffers[i].data() + mBuffers[i].size()) {
+                request.bufferIndex = static_cast<i32>(i);
+                break;
+            }
+        }
+        mQueued.push_back(slot);
+        mInFlight.fetch_add(1, eastl::memory_order_relaxed);
+        return { slot, request.generation };
+    }
+
+    void AsyncFileIO::Submit() {
+        std::lock_guard lock(mMutex);
+        SubmitLocked();
+    }
+
+    void AsyncFileIO::SubmitLocked() {
+        if (mQueued.empty()) {
+            return;
+        }
+#if defined(PYRO_ASYNC_FILE_IO_URING)
+        if (mRing) {
+            if (mRingError != 0) {
+                FailRing(mRingError);
+                return;
+            }
+            for (u32 slot : mQueued) {
+                io_uring_sqe* sqe = mRing->NextSqe();
+                while (!sqe) {
+                    // only when the kernel is slow to consume, the in flight limit keeps the SQ from filling up
+                    const int error = mRing->Enter(0);
+                    if (error != 0 && !Ring::IsTransient(error)) {
+                        FailRing(error);
+                        return;
+                    }
+                    sqe = mRing->NextSqe();
+                }
+                Request& request = mRequests[slot];
+                const bool fixed = request.bufferIndex >= 0;
+                if (request.op == RequestOp::Read) {
+                    sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+                } else {
+                    sqe->opcode = fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+                }
+                // a split request continues where its previous part stopped
+                sqe->fd = request.file->mFd;
+                sqe->addr = reinterpret_cast<u64>(static_cast<u8*>(request.data) + request.result);
+                sqe->len = static_cast<u32>(eastl::min(request.size - request.result, mConfig.maxTransferSize));
+                sqe->off = request.offset + request.result;
+                sqe->buf_index = fixed ? static_cast<u16>(request.bufferIndex) : 0;
+                sqe->user_data = slot;
+                request.state = RequestState::Submitted;
+                mRing->Push();
+            }
+            mQueued.clear();
+            // one syscall for the whole batch, whatever the kernel can't take now goes with the next enter
+            while (mRing->unsubmitted > 0) {
+                const int error = mRing->Enter(0);
+                if (Ring::IsTransient(error)) {
+                    break;
+                }
+                if (error != 0) {
+                    FailRing(error);
+                    return;
+                }
+            }
+            return;
+        }
+#endif
+        for (u32 slot : mQueued) {
+            mRequests[slot].state = RequestState::Submitted;
+        }
+        mWork.insert(mWork.end(), mQueued.begin(), mQueued.end());
+        mQueued.clear();
+        mWorkReady.notify_all();
+    }
+
+    void AsyncFileIO::WaitForAnyLocked(std::unique_lock<std::mutex>& lock) {
+        if (mRing) {
+            ReapRing(true);
+            return;
+        }
+        const u32 inFlight = mInFlight.load(eastl::memory_order_relaxed);
+        mWorkDone.wait(lock, [&] { return mInFlight.load(eastl::memory_order_relaxed) < inFlight; });
+    }
+
+    void AsyncFileIO::ReapRing(bool block) {
+#if defined(PYRO_ASYNC_FILE_IO_URING)
+        // completions after a failure may name slots that were reused since
+        if (mRingError != 0) {
+            return;
+        }
+        u32 head = *mRing->cqHead;
+        if (block) {
+            while (head == std::atomic_ref<u32>(*mRing->cqTail).load(std::memory_order_acquire)) {
+                const int error = mRing->Enter(1);
+                if (Ring::IsTransient(error)) {
+                    std::this_thread::yield();
+                } else if (error != 0) {
+                    FailRing(error);
+                    return;
+                }
+            }
+        }
+        const u32 tail = std::atomic_ref<u32>(*mRing->cqTail).load(std::memory_order_acquire);
+        bool resubmit = false;
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = mRing->cqes[head & mRing->cqMask];
+            const u32 slot = static_cast<u32>(cqe.user_data);
+            Request& request = mRequests[slot];
+            if (cqe.res < 0) {
+                request.error = -cqe.res;
+            } else {
+                const usize requested = eastl::min(request.size - request.result, mConfig.maxTransferSize);
+                request.result += static_cast<usize>(cqe.res);
+                // a full part of a split request, anything shorter is the end of the file or a short write
+                if (static_cast<usize>(cqe.res) == requested && request.result < request.size) {
+                    request.state = RequestState::Queued;
+                    mQueued.push_back(slot);
+                    resubmit = true;
+                    continue;
+                }
+            }
+            request.state = RequestState::Complete;
+            mInFlight.fetch_sub(1, eastl::memory_order_relaxed);
+        }
+        std::atomic_ref<u32>(*mRing->cqHead).store(head, std::memory_order_release);
+        if (resubmit) {
+            SubmitLocked();
+        }
+#else
+        (void)block;
+#endif
+    }
+
+    void AsyncFileIO::FailRing(i32 error) {
+        mRingError = error;
+        for (Request& request : mRequests) {
+            if (request.state == RequestState::Queued || request.state == RequestState::Submitted) {
+                request.error = error;
+                request.state = RequestState::Complete;
+                mInFlight.fetch_sub(1, eastl::memory_order_relaxed);
+            }
+        }
+        mQueued.clear();
+    }
+
+    bool AsyncFileIO::IsLive(AsyncFileHandle handle) const {
+        return handle.slot < mRequests.size() && mRequests[handle.slot].generation == handle.generation &&
+               mRequests[handle.slot].state != RequestState::Free;
+    }
+
+    bool AsyncFileIO::IsComplete(AsyncFileHandle handle) {
+        std::lock_guard lock(mMutex);
+        if (!IsLive(handle)) {
+            return false;
+        }
+        if (mRing) {
+            ReapRing(false);
+        }
+        return mRequests[handle.slot].state == RequestState::Complete;
+    }
+
+    usize AsyncFileIO::Wait(AsyncFileHandle handle) {
+        i32 error;
+        return Wait(handle, error);
+    }
+
+    usize AsyncFileIO::Wait(AsyncFileHandle handle, i32& outError) {
+        std::unique_lock lock(mMutex);
+        if (!IsLive(handle)) {
+            outError = EINVAL;
+            return 0;
+        }
+        if (mRequests[handle.slot].state == RequestState::Queued) {
+            SubmitLocked();
+        }
+        if (mRing) {
+            ReapRing(false);
+        }
+        while (mRequests[handle.slot].state != RequestState::Complete) {
+            WaitForAnyLocked(lock);
+        }
+        const usize result = mRequests[handle.slot].result;
+        outError = mRequests[handle.slot].error;
+        Release(handle.slot);
+        return result;
+    }
+
+    void AsyncFileIO::WaitAll() {
+        std::unique_lock lock(mMutex);
+        SubmitLocked();
+        while (mInFlight.load(eastl::memory_order_relaxed) > 0) {
+            WaitForAnyLocked(lock);
+        }
+        for (u32 slot = 0; slot < mRequests.size(); ++slot) {
+            if (mRequests[slot].state == RequestState::Complete) {
+                Release(slot);
+            }
+        }
+    }
+
+    void AsyncFileIO::Release(u32 slot) {
+        Request& request = mRequests[slot];
+        request.state = RequestState::Free;
+        // stale handles to the slot stop matching
+        ++request.generation;
+        mFreeSlots.push_back(slot);
+    }
+
+    void AsyncFileIO::WorkerLoop() {
+        std::unique_lock lock(mMutex);
+        while (true) {
+            mWorkReady.wait(lock, [&] { return mStopping || !mWork.empty(); });
+            if (mWork.empty()) {
+                return;
+            }
+            const u32 slot = mWork.front();
+            mWork.pop_front();
+            // mRequests may grow while the lock is released
+            const Request request = mRequests[slot];
+            const usize maxTransferSize = mConfig.maxTransferSize;
+            lock.unlock();
+            usize result = 0;
+            i32 error = 0;
+            while (result < request.size) {
+                const usize size = eastl::min(request.size - result, maxTransferSize);
+                u8* data = static_cast<u8*>(request.data) + result;
+                ClearLastError();
+                const usize transferred = request.op == RequestOp::Read
+                                              ? request.file->ReadAt(data, size, request.offset + result)
+                                              : request.file->WriteAt(data, size, request.offset + result);
+                result += transferred;
+                if (transferred != size) {
+                    if (transferred == 0) {
+                        error = LastError();
+                    }
+                    break;
+                }
+            }
+            lock.lock();
+            mRequests[slot].result = result;
+            mRequests[slot].error = error;
+            mRequests[slot].state = RequestState::Complete;
+            mInFlight.fetch_sub(1, eastl::memory_order_relaxed);
+            mWorkDone.notify_all();
+        }
+    }
+} // namespace PyroshockStudios
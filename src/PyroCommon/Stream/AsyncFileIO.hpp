@@ -0,0 +1,153 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "FileStream.hpp"
+
+#include <EASTL/atomic.h>
+#include <EASTL/deque.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace PyroshockStudios {
+    struct AsyncFileIOConfig {
+        static constexpr usize MAX_TRANSFER_SIZE = 0x7FFFF000;
+
+        // Most requests handed to the OS at once, further requests wait for one of them to finish
+        u32 queueDepth = 256;
+        // Threads doing blocking I/O where io_uring isn't available
+        u32 workerCount = 4;
+        // Skips io_uring even where it is available
+        bool forceThreadPool = false;
+        // Largest transfer handed to the OS in one go, bigger requests are split. Capped at what a single
+        // read or write can move on Linux, which also keeps it inside io_uring's 32 bit lengths.
+        usize maxTransferSize = MAX_TRANSFER_SIZE;
+    };
+
+    // Identifies a request until it is waited on
+    struct AsyncFileHandle {
+        u32 slot = ~0u;
+        u32 generation = 0;
+
+        PYRO_NODISCARD bool IsValid() const noexcept { return slot != ~0u; }
+    };
+
+    // Keeps many reads and writes in flight at once, e.g. so an asset loader can keep an NVMe queue full.
+    // ReadAsync/WriteAsync only queue a request, Submit hands everything queued to the OS in one go and
+    // Wait submits on its own. Uses io_uring on Linux and a pool of threads calling FileStream::ReadAt and
+    // WriteAt elsewhere, or when the kernel refuses io_uring.
+    // Meant to be driven by one thread, the files and buffers must stay alive until their requests finish.
+    class AsyncFileIO : DeleteCopy, DeleteMove {
+    public:
+        explicit AsyncFileIO(const AsyncFileIOConfig& config = {});
+        /// Waits for everything in flight.
+        ~AsyncFileIO();
+
+        PYRO_NODISCARD bool UsesIoUring() const noexcept;
+
+        /// Pins the buffers for the lifetime of the AsyncFileIO, requests that fall inside one of them
+        /// skip the per request page mapping. Replaces earlier buffers, nothing may be in flight.
+        /// A no-op for the thread pool.
+        /// @return False if the kernel refused, requests still work without it.
+        PYRO_NODISCARD bool RegisterBuffers(eastl::span<const eastl::span<u8>> buffers);
+
+        /// Queues a read of `size` bytes at `offset`, the stream position isn't used or moved.
+        PYRO_NODISCARD AsyncFileHandle ReadAsync(FileStream& file, void* out, usize size, u64 offset);
+        /// Queues a write of `size` bytes at `offset`, the stream position isn't used or moved.
+        PYRO_NODISCARD AsyncFileHandle WriteAsync(FileStream& file, const void* in, usize size, u64 offset);
+
+        /// Hands every queued request to the OS.
+        void Submit();
+
+        /// True once the request finished, doesn't block.
+        PYRO_NODISCARD bool IsComplete(AsyncFileHandle handle);
+        /// Blocks until the request finished and frees its handle.
+        /// @return The number of bytes transferred, 0 on failure or for a stale handle.
+        PYRO_NODISCARD usize Wait(AsyncFileHandle handle);
+        /// @param outError The errno the request failed with, GetLastError() on Windows, or 0. EINVAL for a stale handle.
+        PYRO_NODISCARD usize Wait(AsyncFileHandle handle, i32& outError);
+        /// Blocks until every request finished and frees all handles.
+        void WaitAll();
+
+        /// Requests submitted or queued that haven't finished yet.
+        PYRO_NODISCARD u32 InFlightCount() const noexcept { return mInFlight.load(eastl::memory_order_relaxed); }
+
+    private:
+        enum struct RequestOp : u8 {
+            Read,
+            Write
+        };
+        enum struct RequestState : u8 {
+            Free,
+            Queued,
+            Submitted,
+            Complete
+        };
+        struct Request {
+            FileStream* file = nullptr;
+            void* data = nullptr;
+            usize size = 0;
+            u64 offset = 0;
+            usize result = 0;
+            i32 error = 0;
+            u32 generation = 0;
+            i32 bufferIndex = -1;
+            RequestOp op = RequestOp::Read;
+            RequestState state = RequestState::Free;
+        };
+        struct Ring;
+
+        PYRO_NODISCARD AsyncFileHandle Enqueue(RequestOp op, FileStream& file, void* data, usize size, u64 offset);
+        PYRO_NODISCARD bool IsLive(AsyncFileHandle handle) const;
+        void Release(u32 slot);
+        // Called with mMutex held
+        void SubmitLocked();
+        // Blocks until at least one more request finished
+        void WaitForAnyLocked(std::unique_lock<std::mutex>& lock);
+        void ReapRing(bool block);
+        // Fails everything not yet complete, the ring isn't used again after io_uring_enter failed for good
+        void FailRing(i32 error);
+        void WorkerLoop();
+
+        AsyncFileIOConfig mConfig;
+        eastl::vector<Request> mRequests;
+        eastl::vector<u32> mFreeSlots;
+        eastl::vector<u32> mQueued;
+        eastl::vector<eastl::span<u8>> mBuffers;
+        eastl::atomic<u32> mInFlight = 0;
+
+        // io_uring, null when the thread pool is used
+        Ring* mRing = nullptr;
+        i32 mRingError = 0;
+
+        // guards the request states, only contended with the thread pool
+        std::mutex mMutex;
+        std::condition_variable mWorkReady;
+        std::condition_variable mWorkDone;
+        eastl::deque<u32> mWork;
+        eastl::vector<std::thread> mWorkers;
+        bool mStopping = false;
+    };
+} // namespace PyroshockStudios
@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BufferedReader.hpp"
+
+#include <EASTL/algorithm.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    BufferedReader::BufferedReader(IStreamReader& inner, usize bufferSize)
+        : mInner(inner), mBuffer(eastl::max<usize>(bufferSize, 1)), mBufferPosition(inner.Tell()) {}
+
+    bool BufferedReader::Seek(isize offset, StreamOrigin origin) {
+        isize target;
+        switch (origin) {
+        case StreamOrigin::Start:
+            target = offset;
+            break;
+        case StreamOrigin::Current:
+            target = static_cast<isize>(Tell()) + offset;
+            break;
+        default: {
+            // leave the meaning of the offset to the wrapped stream
+            const bool result = mInner.Seek(offset, origin);
+            mBufferPosition = mInner.Tell();
+            mBuffered = mConsumed = 0;
+            return result;
+        }
+        }
+        if (target < 0) {
+            return false;
+        }
+        const usize position = static_cast<usize>(target);
+        if (position >= mBufferPosition && position <= mBufferPosition + mBuffered) {
+            mConsumed = position - mBufferPosition;
+            return true;
+        }
+        // the wrapped stream sits at the end of the buffered window, not at Tell()
+        if (!mInner.Seek(target, StreamOrigin::Start)) {
+            return false;
+        }
+        mBufferPosition = position;
+        mBuffered = mConsumed = 0;
+        return true;
+    }
+
+    usize BufferedReader::Length() {
+        return mInner.Length();
+    }
+
+    usize BufferedReader::Tell() {
+        return mBufferPosition + mConsumed;
+    }
+
+    usize BufferedReader::Read(void* out, usize size) {
+        u8* dst = static_cast<u8*>(out);
+        usize total = eastl::min(size, mBuffered - mConsumed);
+        memcpy(dst, mBuffer.data() + mConsumed, total);
+        mConsumed += total;
+        while (total < size) {
+            // buffer is drained, everything read from here on moves the window
+            mBufferPosition += mBuffered;
+            mBuffered = mConsumed = 0;
+            const usize remaining = size - total;
+            if (remaining >= mBuffer.size()) {
+                const usize read = mInner.Read(dst + total, remaining);
+                mBufferPosition += read;
+                return total + read;
+            }
+            mBuffered = mInner.Read(mBuffer.data(), mBuffer.size());
+            if (mBuffered == 0) {
+                break;
+            }
+            const usize chunk = eastl::min(remaining, mBuffered);
+            memcpy(dst + total, mBuffer.data(), chunk);
+            mConsumed = chunk;
+            total += chunk;
+        }
+        return total;
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,57 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "IStreamReader.hpp"
+
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    // Reads ahead from the wrapped stream a buffer at a time and serves small reads from memory,
+    // e.g. BinarySerializer reading from a FileStream would otherwise make a syscall per field.
+    // Reads at least as large as the buffer go straight through. Seeking inside the buffered
+    // window is free, anywhere else drops the buffer.
+    class BufferedReader : public IStreamReader, DeleteCopy, DeleteMove {
+    public:
+        static constexpr usize DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        /// Reads from `inner`, which must outlive the BufferedReader.
+        explicit BufferedReader(IStreamReader& inner, usize bufferSize = DEFAULT_BUFFER_SIZE);
+        ~BufferedReader() = default;
+
+        PYRO_NODISCARD bool Seek(isize offset, StreamOrigin origin) override;
+        PYRO_NODISCARD usize Length() override;
+        PYRO_NODISCARD usize Tell() override;
+
+        PYRO_NODISCARD usize Read(void* out, usize size) override;
+
+        PYRO_NODISCARD usize BufferSize() const noexcept { return mBuffer.size(); }
+
+    private:
+        IStreamReader& mInner;
+        eastl::vector<u8> mBuffer;
+        // Stream position of mBuffer[0]
+        usize mBufferPosition = 0;
+        usize mBuffered = 0;
+        usize mConsumed = 0;
+    };
+} // namespace PyroshockStudios
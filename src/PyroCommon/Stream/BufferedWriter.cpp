@@ -0,0 +1,84 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BufferedWriter.hpp"
+
+#include <EASTL/algorithm.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    BufferedWriter::BufferedWriter(IStreamWriter& inner, usize bufferSize)
+        : mInner(inner), mBuffer(eastl::max<usize>(bufferSize, 1)), mInnerPosition(inner.Tell()) {}
+
+    BufferedWriter::~BufferedWriter() {
+        (void)Flush();
+    }
+
+    bool BufferedWriter::Seek(isize offset, StreamOrigin origin) {
+        if (!Flush()) {
+            return false;
+        }
+        const bool result = mInner.Seek(offset, origin);
+        mInnerPosition = mInner.Tell();
+        return result;
+    }
+
+    usize BufferedWriter::Length() {
+        return eastl::max(mInner.Length(), mInnerPosition + mBuffered);
+    }
+
+    usize BufferedWriter::Tell() {
+        return mInnerPosition + mBuffered;
+    }
+
+    bool BufferedWriter::Resize(usize bytes) {
+        return Flush() && mInner.Resize(bytes);
+    }
+
+    usize BufferedWriter::Write(const void* bytes, usize size) {
+        if (mBuffered + size > mBuffer.size()) {
+            (void)Flush();
+        }
+        if (size >= mBuffer.size()) {
+            // nothing to gain from copying it first
+            const usize written = mInner.Write(bytes, size);
+            mInnerPosition += written;
+            mFailed |= written != size;
+            return written;
+        }
+        memcpy(mBuffer.data() + mBuffered, bytes, size);
+        mBuffered += size;
+        return size;
+    }
+
+    bool BufferedWriter::Flush() {
+        if (mBuffered == 0) {
+            return true;
+        }
+        const usize written = mInner.Write(mBuffer.data(), mBuffered);
+        mInnerPosition += written;
+        const bool complete = written == mBuffered;
+        mFailed |= !complete;
+        mBuffered = 0;
+        return complete;
+    }
+} // namespace PyroshockStudios
@@ -0,0 +1,68 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "IStreamWriter.hpp"
+
+#include <EASTL/vector.h>
+
+namespace PyroshockStudios {
+    // Gathers small writes into a buffer and hands them to the wrapped stream in one Write per buffer,
+    // e.g. BinarySerializer writing to a FileStream would otherwise make a syscall per field.
+    // Writes at least as large as the buffer go straight through. The wrapped stream must not be used
+    // directly while the BufferedWriter holds data, Seek and Resize flush first.
+    class BufferedWriter : public IStreamWriter, DeleteCopy, DeleteMove {
+    public:
+        static constexpr usize DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        /// Writes to `inner`, which must outlive the BufferedWriter.
+        explicit BufferedWriter(IStreamWriter& inner, usize bufferSize = DEFAULT_BUFFER_SIZE);
+        /// Flushes whatever is still buffered.
+        ~BufferedWriter();
+
+        PYRO_NODISCARD bool Seek(isize offset, StreamOrigin origin) override;
+        /// Includes the buffered bytes.
+        PYRO_NODISCARD usize Length() override;
+        /// Includes the buffered bytes.
+        PYRO_NODISCARD usize Tell() override;
+
+        PYRO_NODISCARD bool Resize(usize bytes) override;
+        /// Buffered writes always succeed here, a failure of the wrapped stream shows up in Flush and IsGood.
+        PYRO_NODISCARD usize Write(const void* bytes, usize size) override;
+
+        /// Writes the buffered bytes to the wrapped stream.
+        /// @return False if the wrapped stream took fewer bytes than it was given this time, true if nothing was buffered.
+        PYRO_NODISCARD bool Flush();
+
+        /// False once any write to the wrapped stream came up short, and stays false.
+        PYRO_NODISCARD bool IsGood() const noexcept { return !mFailed; }
+        PYRO_NODISCARD usize BufferSize() const noexcept { return mBuffer.size(); }
+
+    private:
+        IStreamWriter& mInner;
+        eastl::vector<u8> mBuffer;
+        usize mBuffered = 0;
+        // Position of the wrapped stream, where the buffered bytes go
+        usize mInnerPosition = 0;
+        bool mFailed = false;
+    };
+} // namespace PyroshockStudios
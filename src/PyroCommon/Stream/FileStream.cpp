@@ -35,6 +35,23 @@
 #endif
 
 namespace PyroshockStudios {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+    namespace {
+        // Without an event GetOverlappedResult waits on the file handle, which any finished
+        // request on it signals, so threads reading the same file at once need their own
+        HANDLE OverlappedEvent() {
+            struct ThreadEvent {
+                HANDLE handle = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+                ~ThreadEvent() {
+                    if (handle)
+                        CloseHandle(handle);
+                }
+            };
+            thread_local ThreadEvent tEvent;
+            return tEvent.handle;
+        }
+    } // namespace
+#endif
 
     // Helper to initialize private members that might not be in the header snippet provided
     // Assuming mHandle/mFd and mSeekPos exist in the class private section based on previous context.
@@ -101,6 +118,48 @@ namespace PyroshockStudios {
 #endif
     }
 
+    bool FileStream::IsOpen() const noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return mHandle != INVALID_HANDLE_VALUE;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        return mFd != -1;
+#endif
+    }
+
+    bool FileStream::Preallocate(usize bytes) {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        if (mHandle == INVALID_HANDLE_VALUE)
+            return false;
+
+        // the allocation size is separate from the end of file
+        FILE_ALLOCATION_INFO info = {};
+        info.AllocationSize.QuadPart = static_cast<LONGLONG>(bytes);
+        return SetFileInformationByHandle(mHandle, FileAllocationInfo, &info, sizeof(info)) != 0;
+
+#elif defined(PYRO_PLATFORM_LINUX)
+        if (mFd == -1)
+            return false;
+
+        // KEEP_SIZE leaves the length alone, readers don't see a tail of zeroes
+        return fallocate(mFd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(bytes)) == 0;
+
+#elif defined(PYRO_PLATFORM_FAMILY_APPLE)
+        if (mFd == -1)
+            return false;
+
+        // F_PREALLOCATE doesn't change the length either, try contiguous space first
+        fstore_t store = { F_ALLOCATECONTIG | F_ALLOCATEALL, F_PEOFPOSMODE, 0, static_cast<off_t>(bytes), 0 };
+        if (fcntl(mFd, F_PREALLOCATE, &store) == 0)
+            return true;
+        store.fst_flags = F_ALLOCATEALL;
+        return fcntl(mFd, F_PREALLOCATE, &store) == 0;
+
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
     // ---------------------------------------------------------
     // IStreamBase Implementation
     // ---------------------------------------------------------
@@ -177,6 +236,12 @@ namespace PyroshockStudios {
     // ---------------------------------------------------------
 
     usize FileStream::Read(void* out, usize size) {
+        const usize bytesRead = ReadAt(out, size, mSeekPos);
+        mSeekPos += bytesRead;
+        return bytesRead;
+    }
+
+    usize FileStream::ReadAt(void* out, usize size, u64 offset) {
         if (size == 0)
             return 0;
 
@@ -185,8 +250,9 @@ namespace PyroshockStudios {
             return 0;
 
         OVERLAPPED ol = {};
-        ol.Offset = static_cast<DWORD>(mSeekPos & 0xFFFFFFFF);
-        ol.OffsetHigh = static_cast<DWORD>((mSeekPos >> 32) & 0xFFFFFFFF);
+        ol.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+        ol.OffsetHigh = static_cast<DWORD>((offset >> 32) & 0xFFFFFFFF);
+        ol.hEvent = OverlappedEvent();
 
         DWORD bytesRead = 0;
         // Try reading
@@ -204,7 +270,6 @@ namespace PyroshockStudios {
             GetOverlappedResult(mHandle, &ol, &bytesRead, FALSE);
         }
 
-        mSeekPos += bytesRead;
         return static_cast<usize>(bytesRead);
 
 #elif defined(PYRO_PLATFORM_FAMILY_UNIX)
@@ -212,12 +277,11 @@ namespace PyroshockStudios {
             return 0;
 
         // pread reads from specific offset without modifying underlying file descriptor pointer
-        ssize_t result = pread(mFd, out, size, mSeekPos);
+        ssize_t result = pread(mFd, out, size, static_cast<off_t>(offset));
         if (result < 0) {
             return 0;
         }
 
-        mSeekPos += result;
         return static_cast<usize>(result);
 #endif
     }
@@ -227,6 +291,12 @@ namespace PyroshockStudios {
     // ---------------------------------------------------------
 
     usize FileStream::Write(const void* in, usize size) {
+        const usize bytesWritten = WriteAt(in, size, mSeekPos);
+        mSeekPos += bytesWritten;
+        return bytesWritten;
+    }
+
+    usize FileStream::WriteAt(const void* in, usize size, u64 offset) {
         if (size == 0)
             return 0;
 
@@ -235,8 +305,9 @@ namespace PyroshockStudios {
             return 0;
 
         OVERLAPPED ol = {};
-        ol.Offset = static_cast<DWORD>(mSeekPos & 0xFFFFFFFF);
-        ol.OffsetHigh = static_cast<DWORD>((mSeekPos >> 32) & 0xFFFFFFFF);
+        ol.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+        ol.OffsetHigh = static_cast<DWORD>((offset >> 32) & 0xFFFFFFFF);
+        ol.hEvent = OverlappedEvent();
 
         DWORD bytesWritten = 0;
         if (!WriteFile(mHandle, in, static_cast<DWORD>(size), nullptr, &ol)) {
@@ -250,19 +321,17 @@ namespace PyroshockStudios {
             GetOverlappedResult(mHandle, &ol, &bytesWritten, FALSE);
         }
 
-        mSeekPos += bytesWritten;
         return static_cast<usize>(bytesWritten);
 
 #elif defined(PYRO_PLATFORM_FAMILY_UNIX)
         if (mFd == -1)
             return 0;
 
-        ssize_t result = pwrite(mFd, in, size, mSeekPos);
+        ssize_t result = pwrite(mFd, in, size, static_cast<off_t>(offset));
         if (result < 0) {
             return 0;
         }
 
-        mSeekPos += result;
         return static_cast<usize>(result);
 #endif
     }
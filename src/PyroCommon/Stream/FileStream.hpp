@@ -49,6 +49,14 @@ namespace PyroshockStudios {
 
         ~FileStream();
 
+        /// False if the file couldn't be opened.
+        PYRO_NODISCARD bool IsOpen() const noexcept;
+
+        /// Reserves disk space for the first `bytes` of the file without changing its length,
+        /// so later writes into that range neither fragment the file nor fail for lack of space.
+        /// @return False if the platform or file system can't preallocate.
+        PYRO_NODISCARD bool Preallocate(usize bytes);
+
         PYRO_NODISCARD bool Seek(isize offset, StreamOrigin origin) override;
         PYRO_NODISCARD usize Length() override;
         PYRO_NODISCARD usize Tell() override;
@@ -58,7 +66,16 @@ namespace PyroshockStudios {
 
         PYRO_NODISCARD usize Read(void* out, usize size) override;
 
+        /// Reads at `offset` without moving the stream position, safe to call from several threads at once.
+        /// @return The number of bytes read.
+        PYRO_NODISCARD usize ReadAt(void* out, usize size, u64 offset);
+        /// Writes at `offset` without moving the stream position, safe to call from several threads at once.
+        /// @return The number of bytes written.
+        PYRO_NODISCARD usize WriteAt(const void* in, usize size, u64 offset);
+
     private:
+        friend class AsyncFileIO;
+
         usize mSeekPos = 0;
 
 #if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
@@ -0,0 +1,387 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MappedFileStream.hpp"
+
+#include <EASTL/algorithm.h>
+#include <string.h>
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#error "Missing MappedFileStream.cpp implementation for this platform!"
+#endif
+
+namespace PyroshockStudios {
+    namespace {
+        // Writable mappings grow at least this much at a time
+        constexpr usize MIN_MAPPED_GROWTH = 64 * 1024;
+
+        usize PageSize() {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+            static const usize gPageSize = [] {
+                SYSTEM_INFO info;
+                GetSystemInfo(&info);
+                return static_cast<usize>(info.dwAllocationGranularity);
+            }();
+#else
+            static const usize gPageSize = static_cast<usize>(sysconf(_SC_PAGESIZE));
+#endif
+            return gPageSize;
+        }
+    } // namespace
+
+    MappedFileStream::MappedFileStream(const eastl::string& path, Mode mode)
+        : mWritable(mode != Mode::ReadOnly) {
+        usize length = 0;
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        mHandle = INVALID_HANDLE_VALUE;
+        DWORD access = GENERIC_READ;
+        DWORD creation = OPEN_EXISTING;
+        switch (mode) {
+        case Mode::ReadOnly:
+            break;
+        case Mode::WriteOnly:
+            access |= GENERIC_WRITE;
+            creation = CREATE_ALWAYS;
+            break;
+        case Mode::ReadWrite:
+            access |= GENERIC_WRITE;
+            creation = OPEN_ALWAYS;
+            break;
+        }
+        mHandle = CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr, creation, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(mHandle, &fileSize)) {
+            CloseHandle(mHandle);
+            mHandle = INVALID_HANDLE_VALUE;
+            return;
+        }
+        length = static_cast<usize>(fileSize.QuadPart);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        // a shared writable mapping needs read access as well
+        int flags = 0;
+        switch (mode) {
+        case Mode::ReadOnly:
+            flags = O_RDONLY;
+            break;
+        case Mode::WriteOnly:
+            flags = O_RDWR | O_CREAT | O_TRUNC;
+            break;
+        case Mode::ReadWrite:
+            flags = O_RDWR | O_CREAT;
+            break;
+        }
+        mFd = open(path.c_str(), flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (mFd == -1) {
+            return;
+        }
+        struct stat st;
+        if (fstat(mFd, &st) < 0) {
+            close(mFd);
+            mFd = -1;
+            return;
+        }
+        length = static_cast<usize>(st.st_size);
+#endif
+        // an empty file has nothing to map until it is written to
+        if (length > 0 && !Map(length)) {
+            Unmap();
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+            CloseHandle(mHandle);
+            mHandle = INVALID_HANDLE_VALUE;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+            close(mFd);
+            mFd = -1;
+#endif
+            return;
+        }
+        mLength = length;
+    }
+
+    MappedFileStream::~MappedFileStream() {
+        Unmap();
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        if (mHandle != INVALID_HANDLE_VALUE) {
+            if (mWritable) {
+                // drops the spare room the mapping was grown by
+                LARGE_INTEGER li;
+                li.QuadPart = static_cast<LONGLONG>(mLength);
+                if (SetFilePointerEx(mHandle, li, nullptr, FILE_BEGIN)) {
+                    SetEndOfFile(mHandle);
+                }
+            }
+            CloseHandle(mHandle);
+            mHandle = INVALID_HANDLE_VALUE;
+        }
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        if (mFd != -1) {
+            if (mWritable) {
+                // drops the spare room the mapping was grown by
+                (void)ftruncate(mFd, static_cast<off_t>(mLength));
+            }
+            close(mFd);
+            mFd = -1;
+        }
+#endif
+    }
+
+    bool MappedFileStream::IsOpen() const noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return mHandle != INVALID_HANDLE_VALUE;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        return mFd != -1;
+#endif
+    }
+
+    bool MappedFileStream::Map(usize capacity) {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        // a mapping can't change size, a new one replaces it and the old one stays valid if that fails
+        const DWORD protect = mWritable ? PAGE_READWRITE : PAGE_READONLY;
+        // extends the file to the mapping size when writable
+        HANDLE mapping = CreateFileMappingA(mHandle, nullptr, protect, static_cast<DWORD>(static_cast<u64>(capacity) >> 32),
+            static_cast<DWORD>(capacity & 0xFFFFFFFFu), nullptr);
+        if (!mapping) {
+            return false;
+        }
+        void* view = MapViewOfFile(mapping, mWritable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, capacity);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        Unmap();
+        mMapping = mapping;
+        mData = static_cast<u8*>(view);
+        mCapacity = capacity;
+        return true;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        if (mWritable && capacity > mCapacity) {
+            bool allocated = false;
+#if defined(PYRO_PLATFORM_LINUX)
+            // allocates the blocks now, a store into a hole of a full disk would raise SIGBUS
+            allocated = posix_fallocate(mFd, static_cast<off_t>(mCapacity), static_cast<off_t>(capacity - mCapacity)) == 0;
+#endif
+            if (!allocated && ftruncate(mFd, static_cast<off_t>(capacity)) != 0) {
+                return false;
+            }
+        }
+        void* mapping = MAP_FAILED;
+#if defined(PYRO_PLATFORM_LINUX)
+        if (mData) {
+            // moves the page tables instead of faulting everything back in
+            mapping = mremap(mData, mCapacity, capacity, MREMAP_MAYMOVE);
+            if (mapping == MAP_FAILED) {
+                return false;
+            }
+        }
+#endif
+        if (mapping == MAP_FAILED) {
+            mapping = mmap(nullptr, capacity, mWritable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, mFd, 0);
+            if (mapping == MAP_FAILED) {
+                return false;
+            }
+            Unmap();
+        }
+        mData = static_cast<u8*>(mapping);
+        mCapacity = capacity;
+        return true;
+#endif
+    }
+
+    void MappedFileStream::Unmap() {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        if (mData) {
+            UnmapViewOfFile(mData);
+        }
+        if (mMapping) {
+            CloseHandle(mMapping);
+        }
+        mMapping = {};
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        if (mData) {
+            munmap(mData, mCapacity);
+        }
+#endif
+        mData = nullptr;
+        mCapacity = 0;
+    }
+
+    bool MappedFileStream::Reserve(usize bytes) {
+        if (!mWritable || !IsOpen()) {
+            return false;
+        }
+        if (bytes <= mCapacity) {
+            return true;
+        }
+        // doubles, so a stream written in small pieces remaps a logarithmic number of times
+        const usize capacity = PYRO_ALIGN(eastl::max({ bytes, mCapacity * 2, MIN_MAPPED_GROWTH }), PageSize());
+        return Map(capacity);
+    }
+
+    // ---------------------------------------------------------
+    // IStreamBase Implementation
+    // ---------------------------------------------------------
+
+    bool MappedFileStream::Seek(isize offset, StreamOrigin origin) {
+        if (!IsOpen())
+            return false;
+
+        // same rules as FileStream, so the two can be swapped
+        usize newPos = 0;
+        switch (origin) {
+        case StreamOrigin::Start:
+            if (offset < 0)
+                return false;
+            newPos = static_cast<usize>(offset);
+            break;
+        case StreamOrigin::End:
+            if (offset > 0 || static_cast<usize>(-offset) > mLength)
+                return false;
+            newPos = mLength + offset;
+            break;
+        case StreamOrigin::Current:
+            if (offset < 0 && static_cast<usize>(-offset) > mPosition)
+                return false;
+            newPos = mPosition + offset;
+            break;
+        }
+        mPosition = newPos;
+        return true;
+    }
+
+    usize MappedFileStream::Length() {
+        return mLength;
+    }
+
+    usize MappedFileStream::Tell() {
+        return mPosition;
+    }
+
+    // ---------------------------------------------------------
+    // IStreamReader Implementation
+    // ---------------------------------------------------------
+
+    usize MappedFileStream::Read(void* out, usize size) {
+        if (mPosition >= mLength)
+            return 0;
+        const usize readSize = eastl::min(size, mLength - mPosition);
+        memcpy(out, mData + mPosition, readSize);
+        mPosition += readSize;
+        return readSize;
+    }
+
+    // ---------------------------------------------------------
+    // IStreamWriter Implementation
+    // ---------------------------------------------------------
+
+    usize MappedFileStream::Write(const void* in, usize size) {
+        if (size == 0 || !Reserve(mPosition + size))
+            return 0;
+
+        // the gap left by seeking past the end reads as zeroes, like in a file
+        if (mPosition > mLength) {
+            memset(mData + mLength, 0, mPosition - mLength);
+        }
+        memcpy(mData + mPosition, in, size);
+        mPosition += size;
+        mLength = eastl::max(mLength, mPosition);
+        return size;
+    }
+
+    bool MappedFileStream::Resize(usize bytes) {
+        if (!Reserve(bytes))
+            return false;
+
+        // a shrink keeps the mapping, the old bytes are still in it
+        if (bytes > mLength) {
+            memset(mData + mLength, 0, bytes - mLength);
+        }
+        mLength = bytes;
+        return true;
+    }
+
+    eastl::span<const u8> MappedFileStream::Span() const {
+        return { mData, mLength };
+    }
+
+    eastl::span<u8> MappedFileStream::WritableSpan() {
+        if (!mWritable)
+            return {};
+        return { mData, mLength };
+    }
+
+    bool MappedFileStream::Advise(AccessHint hint, usize offset, usize size) {
+        if (offset >= mLength)
+            return false;
+        size = eastl::min(size, mLength - offset);
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        if (hint != AccessHint::WillNeed)
+            return false;
+        WIN32_MEMORY_RANGE_ENTRY range = { mData + offset, size };
+        return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        int advice = MADV_NORMAL;
+        switch (hint) {
+        case AccessHint::Normal:
+            advice = MADV_NORMAL;
+            break;
+        case AccessHint::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessHint::Random:
+            advice = MADV_RANDOM;
+            break;
+        case AccessHint::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+        case AccessHint::DontNeed:
+            advice = MADV_DONTNEED;
+            break;
+        }
+        // madvise wants a page aligned start
+        const usize start = offset & ~(PageSize() - 1);
+        return madvise(mData + start, size + (offset - start), advice) == 0;
+#endif
+    }
+
+    bool MappedFileStream::Flush() {
+        if (!mData || !mWritable)
+            return IsOpen();
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return FlushViewOfFile(mData, mLength) && FlushFileBuffers(mHandle);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        return msync(mData, mCapacity, MS_SYNC) == 0;
+#endif
+    }
+} // namespace PyroshockStudios
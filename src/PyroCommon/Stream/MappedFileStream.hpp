@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include "FileStream.hpp"
+
+#include <EASTL/span.h>
+
+namespace PyroshockStudios {
+    // Maps the whole file into memory, Read and Write are plain copies from and to the mapping and Span()
+    // hands out the contents without copying at all, e.g. for assets and snapshots that are parsed in place.
+    // Writable files are mapped with room to spare and remapped when a write runs past it, the file is cut
+    // back to its length when the stream closes.
+    class MappedFileStream : public IStreamWriter, public IStreamReader, DeleteCopy, DeleteMove {
+    public:
+        using Mode = FileStream::Mode;
+
+        // Passed on to madvise, Windows only acts on WillNeed
+        enum struct AccessHint {
+            Normal,
+            Sequential,
+            Random,
+            WillNeed,
+            DontNeed
+        };
+
+        MappedFileStream(const eastl::string& path, Mode mode);
+
+        ~MappedFileStream();
+
+        /// False if the file couldn't be opened or mapped.
+        PYRO_NODISCARD bool IsOpen() const noexcept;
+
+        PYRO_NODISCARD bool Seek(isize offset, StreamOrigin origin) override;
+        PYRO_NODISCARD usize Length() override;
+        PYRO_NODISCARD usize Tell() override;
+
+        PYRO_NODISCARD bool Resize(usize bytes) override;
+        PYRO_NODISCARD usize Write(const void* bytes, usize size) override;
+
+        PYRO_NODISCARD usize Read(void* out, usize size) override;
+
+        /// The whole file, valid until the next Write or Resize that grows it.
+        PYRO_NODISCARD eastl::span<const u8> Span() const;
+        /// As Span(), but writable, empty for read only streams.
+        PYRO_NODISCARD eastl::span<u8> WritableSpan();
+
+        /// Tells the OS how the range is going to be used.
+        /// @param size Bytes from `offset`, the default is the rest of the file.
+        /// @return False if the platform ignored the hint.
+        PYRO_NODISCARD bool Advise(AccessHint hint, usize offset = 0, usize size = ~0ull);
+
+        /// Writes dirty pages back to disk and waits for them.
+        PYRO_NODISCARD bool Flush();
+
+    private:
+        PYRO_NODISCARD bool Reserve(usize bytes);
+        PYRO_NODISCARD bool Map(usize capacity);
+        void Unmap();
+
+        u8* mData = nullptr;
+        usize mLength = 0;
+        // Mapped bytes, the file on disk is this long while the stream is open
+        usize mCapacity = 0;
+        usize mPosition = 0;
+        bool mWritable = false;
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        HANDLE mHandle = {};
+        HANDLE mMapping = {};
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        int mFd = -1;
+#else
+#endif
+    };
+} // namespace PyroshockStudios
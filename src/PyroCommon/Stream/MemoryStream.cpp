@@ -22,24 +22,54 @@
 
 #include "MemoryStream.hpp"
 
+#include <EASTL/utility.h>
 #include <libassert/assert.hpp>
 #include <string.h>
 
 namespace PyroshockStudios {
+    MemoryStream::MemoryStream(IAllocator* allocator) : mBuffer(PolymorphicAllocator(allocator, "MemoryStream")) {}
+    MemoryStream::MemoryStream(IAllocator* allocator, usize capacity)
+        : mBuffer(PolymorphicAllocator(allocator, "MemoryStream")), mFixedCapacity(capacity) {
+        mBuffer.reserve(capacity);
+    }
+    MemoryStream::MemoryStream(VirtualBuffer&& buffer) : mVirtualBuffer(eastl::move(buffer)), mUseVirtualBuffer(true) {}
+
+    const u8* MemoryStream::BufferData() const {
+        return mUseVirtualBuffer ? mVirtualBuffer.Data() : mBuffer.data();
+    }
+    usize MemoryStream::BufferSize() const {
+        return mUseVirtualBuffer ? mVirtualBuffer.Size() : mBuffer.size();
+    }
+
     bool MemoryStream::Resize(usize bytes) {
+        if (mUseVirtualBuffer) {
+            return mVirtualBuffer.Resize(mVirtualBuffer.Size() + bytes);
+        }
+        if (mFixedCapacity != 0 && mBuffer.size() + bytes > mFixedCapacity) {
+            return false;
+        }
         mBuffer.resize(mBuffer.size() + bytes);
         return true;
     }
     usize MemoryStream::Write(const void* bytes, usize size) {
         const u8* src = static_cast<const u8*>(bytes);
-        mBuffer.insert(mBuffer.begin() + mPosition, src, src + size);
+        if (mUseVirtualBuffer) {
+            if (!mVirtualBuffer.Insert(mPosition, src, size)) {
+                return 0;
+            }
+        } else {
+            if (mFixedCapacity != 0 && mBuffer.size() + size > mFixedCapacity) {
+                return 0;
+            }
+            mBuffer.insert(mBuffer.begin() + mPosition, src, src + size);
+        }
         mPosition += size;
         return size;
     }
 
     usize MemoryStream::Read(void* out, usize size) {
-        usize readSize = std::min(mBuffer.size() - mPosition, size);
-        memcpy(out, mBuffer.data() + mPosition, readSize);
+        usize readSize = std::min(BufferSize() - mPosition, size);
+        memcpy(out, BufferData() + mPosition, readSize);
         mPosition += readSize;
         return readSize;
     }
@@ -51,7 +81,7 @@ namespace PyroshockStudios {
             ASSERT(offset >= 0, "Start offset must be positive!");
             if (offset < 0)
                 return false;
-            if (offset >= mBuffer.size()) {
+            if (offset >= BufferSize()) {
                 return false;
             }
             mPosition = offset;
@@ -60,13 +90,13 @@ namespace PyroshockStudios {
             ASSERT(offset >= 0, "End offset must be positive!");
             if (offset < 0)
                 return false;
-            if ((mBuffer.size() + offset) < 0) {
+            if ((BufferSize() + offset) < 0) {
                 return false;
             }
-            mPosition = mBuffer.size() - offset;
+            mPosition = BufferSize() - offset;
             return true;
         case StreamOrigin::Current:
-            if ((mPosition + offset) < 0 || (mPosition + offset) >= mBuffer.size()) {
+            if ((mPosition + offset) < 0 || (mPosition + offset) >= BufferSize()) {
                 return false;
             }
             mPosition += offset;
@@ -77,13 +107,13 @@ namespace PyroshockStudios {
     }
 
     usize MemoryStream::Length() {
-        return mBuffer.size();
+        return BufferSize();
     }
 
     usize MemoryStream::Tell(){
         return mPosition;
     }
 
-    eastl::span<const u8> MemoryStream::Span() const { return { mBuffer.data(), mBuffer.size() }; }
+    eastl::span<const u8> MemoryStream::Span() const { return { BufferData(), BufferSize() }; }
 
 } // namespace PyroshockStudios
@@ -23,7 +23,9 @@
 #pragma once
 #include "IStreamReader.hpp"
 #include "IStreamWriter.hpp"
+#include <PyroCommon/Allocator.hpp>
 #include <PyroCommon/Core.hpp>
+#include <PyroCommon/VirtualBuffer.hpp>
 
 #include <EASTL/span.h>
 #include <EASTL/vector.h>
@@ -33,6 +35,15 @@ namespace PyroshockStudios {
     class MemoryStream : public IStreamReader, public IStreamWriter {
     public:
         MemoryStream() = default;
+        // Backs the stream with memory from the given allocator, e.g. a per-frame Arena.
+        // An Arena never takes memory back, every buffer the stream outgrows stays in it until the next reset
+        explicit MemoryStream(IAllocator* allocator);
+        // Allocates `capacity` bytes once and fails writes that would grow past it, for buffers that must not
+        // leave outgrown copies behind, e.g. large long-lived ones in an Arena with ArenaBacking::HugePages
+        MemoryStream(IAllocator* allocator, usize capacity);
+        // Backs the stream with a VirtualBuffer, so growing never copies the data written so far.
+        // Suited to large streams with a known upper bound, e.g. MemoryStream(VirtualBuffer(4ull << 30))
+        explicit MemoryStream(VirtualBuffer&& buffer);
         ~MemoryStream() = default;
 
         
@@ -48,7 +59,14 @@ namespace PyroshockStudios {
         PYRO_NODISCARD eastl::span<const u8> Span() const;
 
     private:
-        eastl::vector<u8> mBuffer;
+        PYRO_NODISCARD const u8* BufferData() const;
+        PYRO_NODISCARD usize BufferSize() const;
+
+        eastl::vector<u8, PolymorphicAllocator> mBuffer;
+        VirtualBuffer mVirtualBuffer;
+        bool mUseVirtualBuffer = false;
         usize mPosition = 0;
+        // 0 when the buffer may grow
+        usize mFixedCapacity = 0;
     };
 } // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "VirtualBuffer.hpp"
+#include "VirtualMemory.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/utility.h>
+#include <string.h>
+
+namespace PyroshockStudios {
+    PYRO_COMMON_API VirtualBuffer::VirtualBuffer(usize maxSize) {
+        mReserved = PYRO_ALIGN(maxSize, VirtualMemory::PageSize());
+        mData = static_cast<u8*>(VirtualMemory::Reserve(mReserved));
+        if (!mData) {
+            mReserved = 0;
+        }
+    }
+
+    PYRO_COMMON_API VirtualBuffer::VirtualBuffer(VirtualBuffer&& other) noexcept
+        : mData(eastl::exchange(other.mData, nullptr)),
+          mSize(eastl::exchange(other.mSize, 0)),
+          mCommitted(eastl::exchange(other.mCommitted, 0)),
+          mReserved(eastl::exchange(other.mReserved, 0)),
+          mHighWater(eastl::exchange(other.mHighWater, 0)) {}
+
+    PYRO_COMMON_API VirtualBuffer& VirtualBuffer::operator=(VirtualBuffer&& other) noexcept {
+        if (this != &other) {
+            ReleaseMemory();
+            mData = eastl::exchange(other.mData, nullptr);
+            mSize = eastl::exchange(other.mSize, 0);
+            mCommitted = eastl::exchange(other.mCommitted, 0);
+            mReserved = eastl::exchange(other.mReserved, 0);
+            mHighWater = eastl::exchange(other.mHighWater, 0);
+        }
+        return *this;
+    }
+
+    PYRO_COMMON_API VirtualBuffer::~VirtualBuffer() {
+        ReleaseMemory();
+    }
+
+    PYRO_COMMON_API bool VirtualBuffer::Resize(usize size) {
+        if (size > mReserved) {
+            return false;
+        }
+        if (size > mCommitted) {
+            // grow the committed range geometrically to keep the number of commit calls low
+            usize target = eastl::max(size, mCommitted + mCommitted / 2);
+            target = eastl::min(PYRO_ALIGN(target, COMMIT_GRANULARITY), mReserved);
+            if (!VirtualMemory::Commit(mData + mCommitted, target - mCommitted)) {
+                return false;
+            }
+            mCommitted = target;
+        }
+        if (size > mSize && mHighWater > mSize) {
+            memset(mData + mSize, 0, eastl::min(size, mHighWater) - mSize);
+        }
+        mSize = size;
+        mHighWater = eastl::max(mHighWater, size);
+        return true;
+    }
+
+    PYRO_COMMON_API bool VirtualBuffer::Insert(usize position, const void* bytes, usize size) {
+        usize oldSize = mSize;
+        if (position > oldSize || !Resize(oldSize + size)) {
+            return false;
+        }
+        memmove(mData + position + size, mData + position, oldSize - position);
+        memcpy(mData + position, bytes, size);
+        return true;
+    }
+
+    PYRO_COMMON_API void VirtualBuffer::ShrinkToFit() {
+        usize keep = PYRO_ALIGN(mSize, VirtualMemory::PageSize());
+        if (keep < mCommitted && VirtualMemory::Decommit(mData + keep, mCommitted - keep)) {
+            mCommitted = keep;
+            mHighWater = eastl::min(mHighWater, keep);
+        }
+    }
+
+    PYRO_COMMON_API void VirtualBuffer::ReleaseMemory() {
+        VirtualMemory::Release(mData, mReserved);
+        mData = nullptr;
+        mSize = 0;
+        mCommitted = 0;
+        mReserved = 0;
+        mHighWater = 0;
+    }
+} // namespace PyroshockStudios
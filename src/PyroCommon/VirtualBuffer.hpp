@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+#include <PyroCommon/Traits.hpp>
+
+namespace PyroshockStudios {
+    // Growable byte buffer that reserves its whole address range up front and commits pages as it grows.
+    // Data() never moves and growing never copies, at the cost of a fixed maximum size.
+    // Not thread-safe.
+    class VirtualBuffer : DeleteCopy {
+    public:
+        // Pages are committed in steps of at least this many bytes
+        static constexpr usize COMMIT_GRANULARITY = 64 * 1024;
+
+        VirtualBuffer() = default;
+        /// Reserves `maxSize` bytes of address space, no memory is committed yet.
+        PYRO_COMMON_API explicit VirtualBuffer(usize maxSize);
+        PYRO_COMMON_API VirtualBuffer(VirtualBuffer&& other) noexcept;
+        PYRO_COMMON_API VirtualBuffer& operator=(VirtualBuffer&& other) noexcept;
+        PYRO_COMMON_API ~VirtualBuffer();
+
+        /// Grows or shrinks the buffer, new bytes are zeroed.
+        /// @return false if `size` exceeds MaxSize() or the pages couldn't be committed.
+        PYRO_NODISCARD PYRO_COMMON_API bool Resize(usize size);
+
+        /// Inserts `size` bytes at `position`, moving the bytes after it back.
+        PYRO_NODISCARD PYRO_COMMON_API bool Insert(usize position, const void* bytes, usize size);
+
+        PYRO_FORCEINLINE void Clear() noexcept { mSize = 0; }
+
+        /// Returns the committed pages past Size() to the OS.
+        PYRO_COMMON_API void ShrinkToFit();
+
+        PYRO_NODISCARD PYRO_FORCEINLINE u8* Data() noexcept { return mData; }
+        PYRO_NODISCARD PYRO_FORCEINLINE const u8* Data() const noexcept { return mData; }
+        PYRO_NODISCARD PYRO_FORCEINLINE usize Size() const noexcept { return mSize; }
+        PYRO_NODISCARD PYRO_FORCEINLINE usize CommittedBytes() const noexcept { return mCommitted; }
+        PYRO_NODISCARD PYRO_FORCEINLINE usize MaxSize() const noexcept { return mReserved; }
+
+    private:
+        PYRO_COMMON_API void ReleaseMemory();
+
+        u8* mData = nullptr;
+        usize mSize = 0;
+        usize mCommitted = 0;
+        usize mReserved = 0;
+        // Committed bytes past this point have never been written and are still zero
+        usize mHighWater = 0;
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,167 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "VirtualMemory.hpp"
+
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#else
+#error "Missing VirtualMemory.cpp implementation for this platform!"
+#endif
+
+namespace PyroshockStudios {
+    PYRO_COMMON_API usize VirtualMemory::PageSize() noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        static const usize pageSize = []() {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<usize>(info.dwPageSize);
+        }();
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        static const usize pageSize = static_cast<usize>(sysconf(_SC_PAGESIZE));
+#endif
+        return pageSize;
+    }
+
+    PYRO_COMMON_API usize VirtualMemory::HugePageSize() noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        static const usize hugePageSize = []() {
+            usize largePage = static_cast<usize>(GetLargePageMinimum());
+            return largePage ? largePage : PageSize();
+        }();
+#elif defined(PYRO_PLATFORM_LINUX)
+        static const usize hugePageSize = []() {
+            usize size = 2 * 1024 * 1024;
+            if (FILE* meminfo = fopen("/proc/meminfo", "r")) {
+                char line[128];
+                unsigned long kib = 0;
+                while (fgets(line, sizeof(line), meminfo)) {
+                    if (sscanf(line, "Hugepagesize: %lu kB", &kib) == 1) {
+                        size = static_cast<usize>(kib) * 1024;
+                        break;
+                    }
+                }
+                fclose(meminfo);
+            }
+            return size;
+        }();
+#else
+        static const usize hugePageSize = PageSize();
+#endif
+        return hugePageSize;
+    }
+
+    PYRO_COMMON_API void* VirtualMemory::MapHugePages(usize size, PageBacking* backing) noexcept {
+        PageBacking result = PageBacking::Normal;
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        void* ptr = nullptr;
+        usize largePage = static_cast<usize>(GetLargePageMinimum());
+        if (largePage && size % largePage == 0) {
+            ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            result = PageBacking::Huge;
+        }
+        if (!ptr) {
+            ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            result = PageBacking::Normal;
+        }
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        // only succeeds if the administrator set aside a huge page pool
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        result = PageBacking::Huge;
+#endif
+        if (ptr == MAP_FAILED) {
+            // over-map so the range can be trimmed to start on a huge page boundary
+            usize alignment = HugePageSize();
+            u8* raw = static_cast<u8*>(mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            if (raw == MAP_FAILED) {
+                return nullptr;
+            }
+            u8* aligned = reinterpret_cast<u8*>(PYRO_ALIGN(reinterpret_cast<uptr>(raw), alignment));
+            if (aligned != raw) {
+                munmap(raw, static_cast<usize>(aligned - raw));
+            }
+            usize tail = static_cast<usize>((raw + size + alignment) - (aligned + size));
+            if (tail) {
+                munmap(aligned + size, tail);
+            }
+            ptr = aligned;
+            result = PageBacking::Normal;
+#ifdef MADV_HUGEPAGE
+            if (madvise(ptr, size, MADV_HUGEPAGE) == 0) {
+                result = PageBacking::TransparentHuge;
+            }
+#endif
+        }
+#endif
+        if (backing) {
+            *backing = result;
+        }
+        return ptr;
+    }
+
+    PYRO_COMMON_API void* VirtualMemory::Reserve(usize size) noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        void* ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+    }
+
+    PYRO_COMMON_API bool VirtualMemory::Commit(void* ptr, usize size) noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    PYRO_COMMON_API bool VirtualMemory::Decommit(void* ptr, usize size) noexcept {
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        return VirtualFree(ptr, size, MEM_DECOMMIT) != 0;
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        // mapping fresh inaccessible pages over the range drops the old ones
+        return mmap(ptr, size, PROT_NONE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0) != MAP_FAILED;
+#endif
+    }
+
+    PYRO_COMMON_API void VirtualMemory::Release(void* ptr, usize size) noexcept {
+        if (!ptr) {
+            return;
+        }
+#if defined(PYRO_PLATFORM_FAMILY_WINDOWS)
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#elif defined(PYRO_PLATFORM_FAMILY_UNIX)
+        munmap(ptr, size);
+#endif
+    }
+} // namespace PyroshockStudios
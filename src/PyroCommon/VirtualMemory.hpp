@@ -0,0 +1,61 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Core.hpp>
+
+namespace PyroshockStudios {
+    // Thin wrapper over the platform's virtual memory API.
+    // Reserved ranges only claim address space, pages become usable once committed.
+    class VirtualMemory {
+    public:
+        enum class PageBacking : u8 {
+            Normal,
+            // Huge pages were requested with madvise, the kernel backs the range with them where it can
+            TransparentHuge,
+            Huge
+        };
+
+        PYRO_NODISCARD PYRO_COMMON_API static usize PageSize() noexcept;
+
+        /// Granularity of MapHugePages, the huge page size where the platform has one, the page size otherwise.
+        PYRO_NODISCARD PYRO_COMMON_API static usize HugePageSize() noexcept;
+
+        /// Reserves address space without backing it with memory.
+        /// @return The start of the range, or nullptr on failure.
+        PYRO_NODISCARD PYRO_COMMON_API static void* Reserve(usize size) noexcept;
+
+        /// Makes a page-aligned part of a reserved range readable and writable.
+        PYRO_NODISCARD PYRO_COMMON_API static bool Commit(void* ptr, usize size) noexcept;
+
+        /// Returns the pages of a committed range to the OS, keeping the range reserved.
+        PYRO_COMMON_API static bool Decommit(void* ptr, usize size) noexcept;
+
+        /// Maps committed, zeroed memory backed by huge pages if the system can provide them, normal pages otherwise.
+        /// `size` must be a multiple of HugePageSize(). On Windows large pages need the "Lock pages in memory" privilege.
+        /// @return The start of the range, or nullptr on failure. Release it with Release.
+        PYRO_NODISCARD PYRO_COMMON_API static void* MapHugePages(usize size, PageBacking* backing = nullptr) noexcept;
+
+        /// Releases a whole range returned by Reserve or MapHugePages.
+        PYRO_COMMON_API static void Release(void* ptr, usize size) noexcept;
+    };
+} // namespace PyroshockStudios
\ No newline at end of file
@@ -0,0 +1,67 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+#include <PyroCommon/Logging/LogSuppression.hpp>
+#include <PyroCommon/LoggerInterface.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Test sink shared by the logging tests, records every message it gets and which call site it came from.
+// Safe to log to from several threads, read the members once the producers are done.
+class CollectingLogStream : public PyroshockStudios::ILogStream {
+public:
+    explicit CollectingLogStream(PyroshockStudios::LogSeverity minSeverity = PyroshockStudios::LogSeverity::Verbose)
+        : minSeverity(minSeverity) {}
+    // test streams come and go on the stack, call sites must not keep pointing at them
+    ~CollectingLogStream() { PyroshockStudios::LogSuppression::RemoveStream(this); }
+
+    void Log(PyroshockStudios::LogSeverity severity, const char* message) override {
+        // lets a test hold the consumer up to fill a queue in front of the sink
+        while (blocked.load()) {
+            std::this_thread::yield();
+        }
+        std::lock_guard lock(mutex);
+        messages.emplace_back(message);
+        severities.push_back(severity);
+    }
+    void Log(const PyroshockStudios::LogSite& site, const char* message, PyroshockStudios::usize length) override {
+        {
+            std::lock_guard lock(mutex);
+            sites.push_back(&site);
+        }
+        ILogStream::Log(site, message, length);
+    }
+    PyroshockStudios::LogSeverity MinSeverity() const override { return minSeverity; }
+    const char* Name() const override { return "Collecting"; }
+
+    std::mutex mutex;
+    eastl::vector<eastl::string> messages;
+    eastl::vector<PyroshockStudios::LogSeverity> severities;
+    eastl::vector<const PyroshockStudios::LogSite*> sites;
+    PyroshockStudios::LogSeverity minSeverity;
+    std::atomic<bool> blocked = false;
+};
@@ -0,0 +1,128 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/AllocationTracker.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+TEST(TestAllocationTracker, TagsAreInternedByName) {
+    u16 tag = AllocationTracker::TagFromName("TestTracker.Interned");
+    EXPECT_NE(tag, AllocationTracker::UNTAGGED);
+
+    // same contents at a different address, and immutable for as long as the cache may hold it
+    static const char copy[] = "TestTracker.Interned";
+    EXPECT_EQ(AllocationTracker::TagFromName(copy), tag);
+    EXPECT_EQ(AllocationTracker::TagFromName(nullptr), AllocationTracker::UNTAGGED);
+}
+
+TEST(TestAllocationTracker, TracksLiveAndPeakBytes) {
+    u16 tag = AllocationTracker::TagFromName("TestTracker.LivePeak");
+    AllocationTracker::OnAllocate(tag, 100);
+    AllocationTracker::OnAllocate(tag, 300);
+    AllocationTracker::OnDeallocate(tag, 300);
+
+    AllocationTagStats stats;
+    ASSERT_TRUE(AllocationTracker::QueryTag("TestTracker.LivePeak", stats));
+    EXPECT_EQ(stats.liveBytes, 100);
+    EXPECT_EQ(stats.allocationCount, 2u);
+    EXPECT_EQ(stats.deallocationCount, 1u);
+    // the spike happened between two publishes, the thread's high-water mark still records it
+    EXPECT_EQ(stats.peakBytes, 400);
+
+    AllocationTracker::OnDeallocate(tag, 100);
+    ASSERT_TRUE(AllocationTracker::QueryTag("TestTracker.LivePeak", stats));
+    EXPECT_EQ(stats.liveBytes, 0);
+}
+
+TEST(TestAllocationTracker, PeakFollowsLargeAllocations) {
+    u16 tag = AllocationTracker::TagFromName("TestTracker.Peak");
+    AllocationTracker::OnAllocate(tag, 4 * AllocationTracker::FLUSH_THRESHOLD_BYTES);
+    AllocationTracker::OnDeallocate(tag, 4 * AllocationTracker::FLUSH_THRESHOLD_BYTES);
+
+    AllocationTagStats stats;
+    ASSERT_TRUE(AllocationTracker::QueryTag("TestTracker.Peak", stats));
+    EXPECT_EQ(stats.liveBytes, 0);
+    EXPECT_EQ(stats.peakBytes, 4 * AllocationTracker::FLUSH_THRESHOLD_BYTES);
+}
+
+TEST(TestAllocationTracker, UnknownTagQueryFails) {
+    AllocationTagStats stats;
+    EXPECT_FALSE(AllocationTracker::QueryTag("TestTracker.NeverRegistered", stats));
+}
+
+TEST(TestAllocationTracker, ThreadsPublishOnExit) {
+    u16 tag = AllocationTracker::TagFromName("TestTracker.Threads");
+    constexpr i32 kThreads = 4;
+    constexpr i32 kAllocations = 1000;
+
+    eastl::vector<std::thread> threads;
+    for (i32 t = 0; t < kThreads; ++t) {
+        threads.emplace_back([tag]() {
+            for (i32 i = 0; i < kAllocations; ++i) {
+                AllocationTracker::OnAllocate(tag, 8);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    AllocationTagStats stats;
+    ASSERT_TRUE(AllocationTracker::QueryTag("TestTracker.Threads", stats));
+    EXPECT_EQ(stats.allocationCount, u64(kThreads * kAllocations));
+    EXPECT_EQ(stats.liveBytes, i64(kThreads * kAllocations * 8));
+}
+
+TEST(TestAllocationTracker, SizeHistogram) {
+    AllocationTracker::SizeHistogram before = AllocationTracker::QuerySizeHistogram();
+    u16 tag = AllocationTracker::TagFromName("TestTracker.Histogram");
+    AllocationTracker::OnAllocate(tag, 1000);
+    AllocationTracker::OnDeallocate(tag, 1000);
+    AllocationTracker::SizeHistogram after = AllocationTracker::QuerySizeHistogram();
+
+    // 1000 lies in [512, 1024)
+    EXPECT_EQ(after[10], before[10] + 1);
+}
+
+#ifdef PYRO_COMMON_TRACK_ALLOCATIONS
+TEST(TestAllocationTracker, OverloadedArrayNewIsTracked) {
+    AllocationTagStats before;
+    ASSERT_TRUE(AllocationTracker::QueryTag("Untagged", before));
+
+    void* block = ::operator new[](123);
+    AllocationTagStats during;
+    ASSERT_TRUE(AllocationTracker::QueryTag("Untagged", during));
+    ::operator delete[](block);
+
+    EXPECT_EQ(during.allocationCount, before.allocationCount + 1);
+}
+
+TEST(TestAllocationTracker, OverloadedArrayNewHonoursAlignment) {
+    void* block = ::operator new[](100, static_cast<std::align_val_t>(256));
+    EXPECT_TRUE(PYRO_VERIFY_ALIGNMENT(reinterpret_cast<uptr>(block), 256));
+    ::operator delete[](block, static_cast<std::align_val_t>(256));
+}
+#endif
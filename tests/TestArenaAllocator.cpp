@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Allocator.hpp>
+#include <PyroCommon/Stream/MemoryStream.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+TEST(TestArenaAllocator, RespectsAlignment) {
+    Arena arena(1024);
+    for (usize alignment : { 1, 2, 4, 8, 16, 32, 64, 128 }) {
+        void* ptr = arena.Allocate(3, alignment);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_TRUE(PYRO_VERIFY_ALIGNMENT(reinterpret_cast<uptr>(ptr), alignment));
+    }
+}
+
+TEST(TestArenaAllocator, RespectsAlignmentOffset) {
+    Arena arena(1024);
+    arena.Allocate(1, 1);
+    u8* ptr = static_cast<u8*>(arena.Allocate(64, 32, 8));
+    EXPECT_TRUE(PYRO_VERIFY_ALIGNMENT(reinterpret_cast<uptr>(ptr + 8), 32));
+}
+
+TEST(TestArenaAllocator, ChainsChunksWhenFull) {
+    Arena arena(256);
+    u8* first = static_cast<u8*>(arena.Allocate(200));
+    u8* second = static_cast<u8*>(arena.Allocate(200));
+    EXPECT_NE(first, second);
+    EXPECT_GE(arena.ReservedBytes(), 512u);
+
+    // larger than a chunk gets a dedicated one
+    void* large = arena.Allocate(4096);
+    ASSERT_NE(large, nullptr);
+    memset(large, 0xAB, 4096);
+}
+
+TEST(TestArenaAllocator, ResetReusesChunks) {
+    Arena arena(256);
+    void* first = arena.Allocate(200);
+    arena.Allocate(200);
+    usize reserved = arena.ReservedBytes();
+
+    arena.Reset();
+    EXPECT_EQ(arena.UsedBytes(), 0u);
+    EXPECT_EQ(arena.Allocate(200), first);
+    arena.Allocate(200);
+    EXPECT_EQ(arena.ReservedBytes(), reserved);
+}
+
+TEST(TestArenaAllocator, RewindToMarker) {
+    Arena arena(256);
+    arena.Allocate(32);
+    Arena::Marker marker = arena.GetMarker();
+    usize used = arena.UsedBytes();
+
+    void* scratch = arena.Allocate(64);
+    arena.Allocate(500);
+    arena.Rewind(marker);
+
+    EXPECT_EQ(arena.UsedBytes(), used);
+    EXPECT_EQ(arena.Allocate(64), scratch);
+}
+
+TEST(TestArenaAllocator, EastlVector) {
+    Arena arena(4096);
+    eastl::vector<u32, ArenaAllocator> values{ ArenaAllocator(&arena) };
+    for (u32 i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+    for (u32 i = 0; i < 1000; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+    EXPECT_GT(arena.UsedBytes(), 1000 * sizeof(u32));
+}
+
+TEST(TestArenaAllocator, MemoryStreamScratch) {
+    Arena arena(1024);
+    {
+        MemoryStream stream(&arena);
+        const u32 payload[4] = { 1, 2, 3, 4 };
+        EXPECT_EQ(stream.Write(payload, sizeof(payload)), sizeof(payload));
+        EXPECT_TRUE(stream.Seek(0, StreamOrigin::Start));
+
+        u32 out[4] = {};
+        EXPECT_EQ(stream.Read(out, sizeof(out)), sizeof(out));
+        EXPECT_EQ(memcmp(payload, out, sizeof(out)), 0);
+    }
+    EXPECT_GT(arena.UsedBytes(), 0u);
+    arena.Reset();
+    EXPECT_EQ(arena.UsedBytes(), 0u);
+}
+
+TEST(TestArenaAllocator, FixedCapacityMemoryStream) {
+    Arena arena(64 * 1024);
+    {
+        MemoryStream stream(&arena, 1024);
+        const usize usedAfterReserve = arena.UsedBytes();
+        u8 payload[256] = {};
+        for (u32 i = 0; i < 4; ++i) {
+            ASSERT_EQ(stream.Write(payload, sizeof(payload)), sizeof(payload));
+        }
+        // growing would leave the old buffer behind in the arena, so it fails instead
+        EXPECT_EQ(stream.Write(payload, 1), 0u);
+        EXPECT_FALSE(stream.Resize(1));
+        EXPECT_EQ(stream.Length(), 1024u);
+        EXPECT_EQ(arena.UsedBytes(), usedAfterReserve);
+        EXPECT_LT(arena.UsedBytes(), 2 * 1024u);
+    }
+}
+
+TEST(TestArenaAllocator, HugePageBacking) {
+    Arena arena(1024, ArenaBacking::HugePages);
+    u8* ptr = static_cast<u8*>(arena.Allocate(4096, 64));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(PYRO_VERIFY_ALIGNMENT(reinterpret_cast<uptr>(ptr), 64));
+    // chunks are rounded up to whole huge pages, whether or not the system could provide them
+    EXPECT_GE(arena.ReservedBytes(), 4096u);
+    EXPECT_LE(arena.HugePageBytes(), arena.ReservedBytes());
+    memset(ptr, 0xAB, 4096);
+
+    {
+        MemoryStream stream(&arena, sizeof(u64));
+        u64 value = 0x0123456789ABCDEF;
+        ASSERT_EQ(stream.Write(&value, sizeof(value)), sizeof(value));
+        ASSERT_TRUE(stream.Seek(0, StreamOrigin::Start));
+        u64 readBack = 0;
+        ASSERT_EQ(stream.Read(&readBack, sizeof(readBack)), sizeof(readBack));
+        EXPECT_EQ(readBack, value);
+    }
+
+    arena.ReleaseMemory();
+    EXPECT_EQ(arena.HugePageBytes(), 0u);
+}
@@ -0,0 +1,216 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/AsyncFileIO.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/vector.h>
+#include <errno.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    constexpr usize FILE_SIZE = 1024 * 1024;
+    constexpr usize CHUNK_SIZE = 4096;
+
+    // Every test runs against io_uring, where the kernel allows it, and the thread pool
+    class TestAsyncFileIO : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mPath = (std::filesystem::temp_directory_path() / ("pyro_async_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".bin")).string().c_str();
+            mBytes.resize(FILE_SIZE);
+            for (usize i = 0; i < mBytes.size(); ++i) {
+                mBytes[i] = static_cast<u8>(i * 7 + i / 4096);
+            }
+            FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            ASSERT_EQ(file.Write(mBytes.data(), mBytes.size()), mBytes.size());
+        }
+        void TearDown() override { std::filesystem::remove(mPath.c_str()); }
+
+        static AsyncFileIOConfig Config(bool threadPool, u32 queueDepth = 256, usize maxTransferSize = AsyncFileIOConfig::MAX_TRANSFER_SIZE) {
+            AsyncFileIOConfig config;
+            config.forceThreadPool = threadPool;
+            config.queueDepth = queueDepth;
+            config.maxTransferSize = maxTransferSize;
+            return config;
+        }
+
+        eastl::string mPath;
+        eastl::vector<u8> mBytes;
+    };
+} // namespace
+
+TEST_F(TestAsyncFileIO, ManyReadsInFlight) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        AsyncFileIO io(Config(threadPool));
+        EXPECT_TRUE(!threadPool || !io.UsesIoUring());
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+
+        // backwards, so nothing relies on the requests finishing in order
+        const usize count = FILE_SIZE / CHUNK_SIZE;
+        eastl::vector<u8> out(FILE_SIZE);
+        eastl::vector<AsyncFileHandle> handles;
+        for (usize i = count; i-- > 0;) {
+            handles.push_back(io.ReadAsync(file, out.data() + i * CHUNK_SIZE, CHUNK_SIZE, i * CHUNK_SIZE));
+        }
+        EXPECT_EQ(io.InFlightCount(), count);
+        io.Submit();
+        for (const AsyncFileHandle& handle : handles) {
+            EXPECT_EQ(io.Wait(handle), CHUNK_SIZE);
+        }
+        EXPECT_EQ(io.InFlightCount(), 0u);
+        EXPECT_EQ(out, mBytes);
+        EXPECT_EQ(file.Tell(), 0u);
+    }
+}
+
+TEST_F(TestAsyncFileIO, QueueDepthBoundsInFlight) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        AsyncFileIO io(Config(threadPool, 4));
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+
+        eastl::vector<u8> out(FILE_SIZE);
+        eastl::vector<AsyncFileHandle> handles;
+        for (usize i = 0; i < FILE_SIZE / CHUNK_SIZE; ++i) {
+            handles.push_back(io.ReadAsync(file, out.data() + i * CHUNK_SIZE, CHUNK_SIZE, i * CHUNK_SIZE));
+            EXPECT_LE(io.InFlightCount(), 4u);
+        }
+        for (const AsyncFileHandle& handle : handles) {
+            EXPECT_EQ(io.Wait(handle), CHUNK_SIZE);
+        }
+        EXPECT_EQ(out, mBytes);
+    }
+}
+
+TEST_F(TestAsyncFileIO, WritesLandAtTheirOffsets) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        std::filesystem::remove(mPath.c_str());
+        {
+            AsyncFileIO io(Config(threadPool));
+            FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            for (usize i = 0; i < FILE_SIZE / CHUNK_SIZE; ++i) {
+                (void)io.WriteAsync(file, mBytes.data() + i * CHUNK_SIZE, CHUNK_SIZE, i * CHUNK_SIZE);
+            }
+            io.WaitAll();
+            EXPECT_EQ(io.InFlightCount(), 0u);
+        }
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+        eastl::vector<u8> contents(file.Length());
+        ASSERT_EQ(file.Read(contents.data(), contents.size()), mBytes.size());
+        EXPECT_EQ(contents, mBytes);
+    }
+}
+
+TEST_F(TestAsyncFileIO, RegisteredBuffers) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        AsyncFileIO io(Config(threadPool));
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+
+        eastl::vector<u8> staging(64 * CHUNK_SIZE);
+        const eastl::span<u8> buffers[] = { { staging.data(), staging.size() } };
+        // requests work either way, registering only makes them cheaper
+        (void)io.RegisterBuffers(buffers);
+        eastl::vector<AsyncFileHandle> handles;
+        for (usize i = 0; i < 64; ++i) {
+            handles.push_back(io.ReadAsync(file, staging.data() + i * CHUNK_SIZE, CHUNK_SIZE, (63 - i) * CHUNK_SIZE));
+        }
+        for (const AsyncFileHandle& handle : handles) {
+            EXPECT_EQ(io.Wait(handle), CHUNK_SIZE);
+        }
+        for (usize i = 0; i < 64; ++i) {
+            EXPECT_EQ(memcmp(staging.data() + i * CHUNK_SIZE, mBytes.data() + (63 - i) * CHUNK_SIZE, CHUNK_SIZE), 0) << i;
+        }
+    }
+}
+
+TEST_F(TestAsyncFileIO, ShortReadsAndStaleHandles) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        AsyncFileIO io(Config(threadPool));
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+
+        eastl::vector<u8> out(CHUNK_SIZE);
+        const AsyncFileHandle tail = io.ReadAsync(file, out.data(), out.size(), FILE_SIZE - 100);
+        EXPECT_FALSE(io.IsComplete(tail));
+        EXPECT_EQ(io.Wait(tail), 100u);
+        EXPECT_EQ(memcmp(out.data(), mBytes.data() + FILE_SIZE - 100, 100), 0);
+
+        // the slot is reused, the old handle must not see the new request
+        EXPECT_EQ(io.Wait(tail), 0u);
+        const AsyncFileHandle next = io.ReadAsync(file, out.data(), 10, 0);
+        EXPECT_EQ(next.slot, tail.slot);
+        EXPECT_FALSE(io.IsComplete(tail));
+        EXPECT_EQ(io.Wait(tail), 0u);
+        EXPECT_EQ(io.Wait(next), 10u);
+        EXPECT_EQ(io.Wait(AsyncFileHandle{}), 0u);
+    }
+}
+
+TEST_F(TestAsyncFileIO, LargeRequestsAreSplit) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        // stands in for requests past what one read or write can move, odd so the parts don't line up with pages
+        AsyncFileIO io(Config(threadPool, 2, CHUNK_SIZE + 3));
+        std::filesystem::remove(mPath.c_str());
+        {
+            FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            i32 error = -1;
+            EXPECT_EQ(io.Wait(io.WriteAsync(file, mBytes.data(), mBytes.size(), 0), error), FILE_SIZE);
+            EXPECT_EQ(error, 0);
+        }
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+        eastl::vector<u8> out(FILE_SIZE + CHUNK_SIZE);
+        const AsyncFileHandle whole = io.ReadAsync(file, out.data(), FILE_SIZE, 0);
+        // runs past the end of the file, the last part comes back short
+        const AsyncFileHandle pastEnd = io.ReadAsync(file, out.data() + FILE_SIZE, CHUNK_SIZE, FILE_SIZE - 10);
+        EXPECT_EQ(io.Wait(whole), FILE_SIZE);
+        EXPECT_EQ(io.Wait(pastEnd), 10u);
+        EXPECT_EQ(memcmp(out.data(), mBytes.data(), FILE_SIZE), 0);
+        EXPECT_EQ(io.InFlightCount(), 0u);
+    }
+}
+
+TEST_F(TestAsyncFileIO, FailuresReportTheError) {
+    for (bool threadPool : { false, true }) {
+        SCOPED_TRACE(threadPool ? "thread pool" : "default");
+        AsyncFileIO io(Config(threadPool));
+        FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+
+        eastl::vector<u8> out(CHUNK_SIZE);
+        const AsyncFileHandle handle = io.ReadAsync(file, out.data(), out.size(), 0);
+        i32 error = 0;
+        EXPECT_EQ(io.Wait(handle, error), 0u);
+#if defined(PYRO_PLATFORM_FAMILY_UNIX)
+        EXPECT_EQ(error, EBADF);
+#else
+        EXPECT_NE(error, 0);
+#endif
+        EXPECT_EQ(io.Wait(handle, error), 0u);
+        EXPECT_EQ(error, EINVAL);
+    }
+}
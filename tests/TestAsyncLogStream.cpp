@@ -0,0 +1,223 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logging/AsyncLogStream.hpp>
+
+#include "CollectingLogStream.hpp"
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+TEST(TestAsyncLogStream, DeliversInOrderPerProducer) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks, 64);
+
+    constexpr u32 THREADS = 4;
+    constexpr u32 MESSAGES = 2000;
+    eastl::vector<std::thread> threads;
+    for (u32 t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&stream, t]() {
+            for (u32 i = 0; i < MESSAGES; ++i) {
+                char message[32];
+                snprintf(message, sizeof(message), "%u %u", t, i);
+                stream.Log(LogSeverity::Info, message);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    stream.Flush();
+
+    ASSERT_EQ(sink.messages.size(), THREADS * MESSAGES);
+    EXPECT_EQ(stream.DroppedCount(), 0u);
+    u32 next[THREADS] = {};
+    for (const eastl::string& message : sink.messages) {
+        u32 t = 0, i = 0;
+        ASSERT_EQ(sscanf(message.c_str(), "%u %u", &t, &i), 2);
+        EXPECT_EQ(i, next[t]++);
+    }
+}
+
+TEST(TestAsyncLogStream, FiltersBySinkSeverity) {
+    CollectingLogStream verbose;
+    CollectingLogStream errors;
+    errors.minSeverity = LogSeverity::Error;
+    ILogStream* sinks[] = { &verbose, &errors };
+    AsyncLogStream stream(sinks);
+    EXPECT_EQ(stream.MinSeverity(), LogSeverity::Verbose);
+
+    stream.Log(LogSeverity::Debug, "debug");
+    stream.Log(LogSeverity::Error, "error");
+    stream.Flush();
+
+    EXPECT_EQ(verbose.messages.size(), 2u);
+    ASSERT_EQ(errors.messages.size(), 1u);
+    EXPECT_EQ(errors.messages[0], "error");
+    EXPECT_EQ(errors.severities[0], LogSeverity::Error);
+}
+
+TEST(TestAsyncLogStream, LongMessages) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks, 4);
+
+    eastl::string longMessage(4000, 'x');
+    for (u32 i = 0; i < 16; ++i) {
+        stream.Log(LogSeverity::Info, longMessage.c_str());
+    }
+    stream.Flush();
+    ASSERT_EQ(sink.messages.size(), 16u);
+    EXPECT_EQ(sink.messages[15], longMessage);
+}
+
+TEST(TestAsyncLogStream, DropPolicyCountsLostMessages) {
+    CollectingLogStream sink;
+    sink.blocked = true;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks, 4, LogOverflowPolicy::Drop);
+
+    for (u32 i = 0; i < 100; ++i) {
+        stream.Log(LogSeverity::Info, "message");
+    }
+    sink.blocked = false;
+    stream.Flush();
+
+    EXPECT_GT(stream.DroppedCount(), 0u);
+    EXPECT_EQ(sink.messages.size() + stream.DroppedCount(), 100u);
+}
+
+TEST(TestAsyncLogStream, DropAndReportLogsSummary) {
+    CollectingLogStream sink;
+    sink.blocked = true;
+    ILogStream* sinks[] = { &sink };
+    {
+        AsyncLogStream stream(sinks, 4, LogOverflowPolicy::DropAndReport);
+        for (u32 i = 0; i < 100; ++i) {
+            stream.Log(LogSeverity::Info, "message");
+        }
+        sink.blocked = false;
+    }
+
+    bool reported = false;
+    for (usize i = 0; i < sink.messages.size(); ++i) {
+        if (sink.messages[i].find("dropped") != eastl::string::npos) {
+            reported = true;
+            EXPECT_EQ(sink.severities[i], LogSeverity::Warn);
+        }
+    }
+    EXPECT_TRUE(reported);
+}
+
+TEST(TestAsyncLogStream, BlockPolicyLosesNothing) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    {
+        AsyncLogStream stream(sinks, 2, LogOverflowPolicy::Block);
+        for (u32 i = 0; i < 1000; ++i) {
+            stream.Log(LogSeverity::Info, "message");
+        }
+        EXPECT_EQ(stream.DroppedCount(), 0u);
+    }
+    // destruction drains the ring
+    EXPECT_EQ(sink.messages.size(), 1000u);
+}
+
+TEST(TestAsyncLogStream, DeferredFormatting) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks);
+
+    {
+        eastl::string name = "texture.png";
+        const char* missing = nullptr;
+        stream.LogDeferred(LogSeverity::Warn, "{} of {} loaded from {} ({:.1f}%) {}", 3, 4u, name, 75.0, missing);
+        // captured strings are copies, the originals can go away before the sink thread gets to them
+        name = "overwritten";
+    }
+    stream.LogDeferred(LogSeverity::Info, "no arguments");
+    stream.LogDeferred(LogSeverity::Info, "{} {} {}", 'c', true, "literal");
+    stream.Flush();
+
+    ASSERT_EQ(sink.messages.size(), 3u);
+    EXPECT_EQ(sink.messages[0], "3 of 4 loaded from texture.png (75.0%) (null)");
+    EXPECT_EQ(sink.severities[0], LogSeverity::Warn);
+    EXPECT_EQ(sink.messages[1], "no arguments");
+    EXPECT_EQ(sink.messages[2], "c true literal");
+}
+
+TEST(TestAsyncLogStream, DeferredLargePayload) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks, 4);
+
+    eastl::string longArgument(1000, 'y');
+    for (u32 i = 0; i < 16; ++i) {
+        stream.LogDeferred(LogSeverity::Info, "{}:{}", i, longArgument);
+    }
+    stream.Flush();
+    ASSERT_EQ(sink.messages.size(), 16u);
+    EXPECT_EQ(sink.messages[15], "15:" + longArgument);
+}
+
+TEST(TestAsyncLogStream, DeferredAndTextInterleave) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks, 8);
+
+    for (u32 i = 0; i < 100; ++i) {
+        if (i & 1) {
+            stream.LogDeferred(LogSeverity::Info, "{}", i);
+        } else {
+            stream.Log(LogSeverity::Info, eastl::to_string(i).c_str());
+        }
+    }
+    stream.Flush();
+    ASSERT_EQ(sink.messages.size(), 100u);
+    for (u32 i = 0; i < 100; ++i) {
+        EXPECT_EQ(sink.messages[i], eastl::to_string(i));
+    }
+}
+
+TEST(TestAsyncLogStream, ForwardsCallSites) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    AsyncLogStream stream(sinks);
+
+    PYRO_LOG_ERROR(&stream, "formatted {}", 1);
+    PYRO_LOG_DEFERRED(Error, &stream, "deferred {}", 2);
+    stream.Log(LogSeverity::Error, "plain");
+    stream.Flush();
+
+    ASSERT_EQ(sink.messages.size(), 3u);
+    ASSERT_EQ(sink.sites.size(), 2u);
+    EXPECT_STREQ(sink.sites[0]->format, "formatted {}");
+    EXPECT_EQ(sink.messages[0], "formatted 1");
+    EXPECT_STREQ(sink.sites[1]->format, "deferred {}");
+    EXPECT_EQ(sink.messages[1], "deferred 2");
+    EXPECT_EQ(sink.messages[2], "plain");
+}
@@ -0,0 +1,145 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/AtomicSharedRef.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    struct Table : public RefCounted {
+        explicit Table(u32 version, eastl::atomic<i32>* live) : version(version), live(live) {
+            live->fetch_add(1);
+        }
+        ~Table() override {
+            live->fetch_sub(1);
+        }
+
+        u32 version;
+        eastl::atomic<i32>* live;
+    };
+} // namespace
+
+TEST(TestAtomicSharedRef, LoadStoreExchange) {
+    eastl::atomic<i32> live = { 0 };
+    {
+        AtomicSharedRef<Table> slot;
+        EXPECT_FALSE(slot.Load());
+
+        slot.Store(SharedRef<Table>::Create(1, &live));
+        SharedRef<Table> first = slot.Load();
+        ASSERT_TRUE(first);
+        EXPECT_EQ(first->version, 1u);
+
+        SharedRef<Table> previous = slot.Exchange(SharedRef<Table>::Create(2, &live));
+        EXPECT_EQ(previous.Get(), first.Get());
+        EXPECT_EQ(slot.Load()->version, 2u);
+        EXPECT_EQ(live.load(), 2);
+
+        previous = nullptr;
+        first = nullptr;
+        EXPECT_EQ(live.load(), 1);
+    }
+    EXPECT_EQ(live.load(), 0);
+}
+
+TEST(TestAtomicSharedRef, CompareExchange) {
+    eastl::atomic<i32> live = { 0 };
+    {
+        AtomicSharedRef<Table> slot(SharedRef<Table>::Create(1, &live));
+        SharedRef<Table> expected = slot.Load();
+
+        EXPECT_TRUE(slot.CompareExchange(expected, SharedRef<Table>::Create(2, &live)));
+        EXPECT_EQ(slot.Load()->version, 2u);
+
+        // `expected` still points at version 1
+        EXPECT_FALSE(slot.CompareExchange(expected, SharedRef<Table>::Create(3, &live)));
+        ASSERT_TRUE(expected);
+        EXPECT_EQ(expected->version, 2u);
+        EXPECT_EQ(slot.Load()->version, 2u);
+    }
+    EXPECT_EQ(live.load(), 0);
+}
+
+TEST(TestAtomicSharedRef, ConcurrentReadersAndWriters) {
+    eastl::atomic<i32> live = { 0 };
+    {
+        AtomicSharedRef<Table> slot(SharedRef<Table>::Create(0, &live));
+        eastl::atomic<bool> stop = { false };
+
+        eastl::vector<std::thread> readers;
+        for (i32 t = 0; t < 4; ++t) {
+            readers.emplace_back([&]() {
+                u32 lastSeen = 0;
+                while (!stop.load(eastl::memory_order_relaxed)) {
+                    SharedRef<Table> table = slot.Load();
+                    ASSERT_TRUE(table);
+                    EXPECT_GE(table->version, lastSeen);
+                    lastSeen = table->version;
+                }
+            });
+        }
+        std::thread writer([&]() {
+            for (u32 version = 1; version <= 20000; ++version) {
+                slot.Store(SharedRef<Table>::Create(version, &live));
+            }
+        });
+        writer.join();
+        stop.store(true);
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+        EXPECT_EQ(live.load(), 1);
+    }
+    EXPECT_EQ(live.load(), 0);
+}
+
+TEST(TestAtomicSharedRef, RepublishSameObjects) {
+    eastl::atomic<i32> live = { 0 };
+    {
+        SharedRef<Table> first = SharedRef<Table>::Create(1, &live);
+        SharedRef<Table> second = SharedRef<Table>::Create(2, &live);
+        AtomicSharedRef<Table> slot(first);
+        eastl::atomic<bool> stop = { false };
+
+        eastl::vector<std::thread> readers;
+        for (i32 t = 0; t < 4; ++t) {
+            readers.emplace_back([&]() {
+                while (!stop.load(eastl::memory_order_relaxed)) {
+                    SharedRef<Table> table = slot.Load();
+                    EXPECT_TRUE(table.Get() == first.Get() || table.Get() == second.Get());
+                }
+            });
+        }
+        for (i32 i = 0; i < 20000; ++i) {
+            slot.Store(i & 1 ? first : second);
+        }
+        stop.store(true);
+        for (std::thread& reader : readers) {
+            reader.join();
+        }
+    }
+    EXPECT_EQ(live.load(), 0);
+}
@@ -0,0 +1,177 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logging/BinaryLogReader.hpp>
+#include <PyroCommon/Logging/BinaryLogStream.hpp>
+#include <PyroCommon/Stream/MemoryStream.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    enum class Phase : u8 {
+        Load = 2
+    };
+
+    MemoryStream& Rewind(MemoryStream& stream) {
+        EXPECT_TRUE(stream.Seek(0, StreamOrigin::Start));
+        return stream;
+    }
+
+    // Keeps the reader alive, the records point at its sites
+    struct DecodedLog {
+        explicit DecodedLog(MemoryStream& stream) : reader(Rewind(stream)) {
+            EXPECT_TRUE(reader.IsValid());
+            BinaryLogRecord record;
+            while (reader.Next(record)) {
+                records.push_back(record);
+            }
+        }
+
+        BinaryLogReader reader;
+        eastl::vector<BinaryLogRecord> records;
+    };
+} // namespace
+
+TEST(TestBinaryLog, RoundTripsArguments) {
+    MemoryStream memory;
+    {
+        BinaryLogStream stream(memory);
+        eastl::string name = "texture.png";
+        PYRO_LOG_BINARY(Warn, &stream, "{} {} {} {:.2f} {} {} {} {}", -42, 18446744073709551615ull, name, 2.5f, true, 'x', Phase::Load, "literal");
+    }
+
+    DecodedLog log(memory);
+    const eastl::vector<BinaryLogRecord>& records = log.records;
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message, "-42 18446744073709551615 texture.png 2.50 true x 2 literal");
+    EXPECT_EQ(records[0].severity, LogSeverity::Warn);
+    ASSERT_NE(records[0].site, nullptr);
+    EXPECT_EQ(records[0].site->format, "{} {} {} {:.2f} {} {} {} {}");
+    EXPECT_NE(records[0].site->file.find("TestBinaryLog.cpp"), eastl::string::npos);
+}
+
+TEST(TestBinaryLog, InternsSitesAndKeepsOrder) {
+    MemoryStream memory;
+    {
+        BinaryLogStream stream(memory);
+        for (u32 i = 0; i < 100; ++i) {
+            PYRO_LOG_BINARY(Info, &stream, "iteration {}", i);
+            if (i % 10 == 0) {
+                stream.Log(LogSeverity::Debug, "plain text");
+            }
+        }
+    }
+
+    DecodedLog log(memory);
+    const eastl::vector<BinaryLogRecord>& records = log.records;
+    ASSERT_EQ(records.size(), 110u);
+    u32 iteration = 0;
+    const BinaryLogSite* site = nullptr;
+    for (usize i = 0; i < records.size(); ++i) {
+        if (i > 0) {
+            EXPECT_GE(records[i].timestamp, records[i - 1].timestamp);
+        }
+        if (records[i].message == "plain text") {
+            EXPECT_EQ(records[i].site, nullptr);
+            EXPECT_EQ(records[i].severity, LogSeverity::Debug);
+            continue;
+        }
+        EXPECT_EQ(records[i].message, "iteration " + eastl::to_string(iteration++));
+        site = site ? site : records[i].site;
+        EXPECT_EQ(records[i].site, site);
+    }
+    EXPECT_EQ(iteration, 100u);
+}
+
+TEST(TestBinaryLog, SmallerThanText) {
+    MemoryStream memory;
+    usize textBytes = 0;
+    {
+        BinaryLogStream stream(memory);
+        for (u32 i = 0; i < 1000; ++i) {
+            PYRO_LOG_BINARY(Info, &stream, "[Renderer] frame {} submitted {} draw calls in {:.3f} ms", 100000 + i, 2000 + i % 50, 4.25);
+            textBytes += fmt::formatted_size("[Renderer] frame {} submitted {} draw calls in {:.3f} ms", 100000 + i, 2000 + i % 50, 4.25);
+        }
+    }
+    // the format string is written once, each record is a handful of varints
+    EXPECT_LT(memory.Length() * 2, textBytes);
+}
+
+TEST(TestBinaryLog, KeepsSitesOfFormattedMessages) {
+    MemoryStream memory;
+    {
+        BinaryLogStream stream(memory);
+        PYRO_LOG_ERROR(&stream, "formatted {}", 7);
+    }
+    DecodedLog log(memory);
+    const eastl::vector<BinaryLogRecord>& records = log.records;
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message, "formatted 7");
+    ASSERT_NE(records[0].site, nullptr);
+    EXPECT_EQ(records[0].site->format, "formatted {}");
+}
+
+TEST(TestBinaryLog, FiltersBySeverity) {
+    MemoryStream memory;
+    {
+        BinaryLogStream stream(memory, LogSeverity::Warn);
+        PYRO_LOG_BINARY(Info, &stream, "dropped {}", 1);
+        PYRO_LOG_BINARY(Error, &stream, "kept {}", 2);
+        stream.Log(LogSeverity::Debug, "dropped");
+    }
+    DecodedLog log(memory);
+    const eastl::vector<BinaryLogRecord>& records = log.records;
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message, "kept 2");
+}
+
+TEST(TestBinaryLog, StopsAtTruncatedRecord) {
+    MemoryStream memory;
+    {
+        BinaryLogStream stream(memory);
+        PYRO_LOG_BINARY(Info, &stream, "first {}", eastl::string(100, 'a'));
+        PYRO_LOG_BINARY(Info, &stream, "second {}", eastl::string(100, 'b'));
+    }
+    eastl::span<const u8> bytes = memory.Span();
+    MemoryStream truncated;
+    ASSERT_EQ(truncated.Write(bytes.data(), bytes.size() - 20), bytes.size() - 20);
+
+    DecodedLog log(truncated);
+    const eastl::vector<BinaryLogRecord>& records = log.records;
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message, "first " + eastl::string(100, 'a'));
+}
+
+TEST(TestBinaryLog, RejectsOtherFiles) {
+    MemoryStream memory;
+    const char text[] = "not a binary log at all";
+    ASSERT_EQ(memory.Write(text, sizeof(text)), sizeof(text));
+    ASSERT_TRUE(memory.Seek(0, StreamOrigin::Start));
+    BinaryLogReader reader(memory);
+    EXPECT_FALSE(reader.IsValid());
+    BinaryLogRecord record;
+    EXPECT_FALSE(reader.Next(record));
+}
@@ -0,0 +1,233 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Serialization/BinarySerializer.hpp>
+#include <PyroCommon/Stream/BufferedReader.hpp>
+#include <PyroCommon/Stream/BufferedWriter.hpp>
+#include <PyroCommon/Stream/MemoryStream.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    // Counts the calls that reach the wrapped stream
+    class CountingStream : public IStreamReader, public IStreamWriter {
+    public:
+        PYRO_NODISCARD bool Seek(isize offset, StreamOrigin origin) override { return mInner.Seek(offset, origin); }
+        PYRO_NODISCARD usize Length() override { return mInner.Length(); }
+        PYRO_NODISCARD usize Tell() override { return mInner.Tell(); }
+        PYRO_NODISCARD bool Resize(usize bytes) override { return mInner.Resize(bytes); }
+        PYRO_NODISCARD usize Write(const void* bytes, usize size) override {
+            ++writes;
+            if (failWrites) {
+                return 0;
+            }
+            return mInner.Write(bytes, size);
+        }
+        PYRO_NODISCARD usize Read(void* out, usize size) override {
+            ++reads;
+            return mInner.Read(out, size);
+        }
+
+        usize writes = 0;
+        usize reads = 0;
+        bool failWrites = false;
+
+    private:
+        MemoryStream mInner;
+    };
+
+    eastl::vector<u8> Pattern(usize size) {
+        eastl::vector<u8> bytes(size);
+        for (usize i = 0; i < size; ++i) {
+            bytes[i] = static_cast<u8>(i * 31 + 7);
+        }
+        return bytes;
+    }
+} // namespace
+
+TEST(TestBufferedStream, CoalescesSmallWrites) {
+    CountingStream inner;
+    {
+        BufferedWriter writer(inner, 64);
+        for (u32 i = 0; i < 100; ++i) {
+            EXPECT_EQ(writer.Write(&i, sizeof(i)), sizeof(i));
+        }
+        EXPECT_EQ(writer.Tell(), 400u);
+        EXPECT_EQ(writer.Length(), 400u);
+        EXPECT_LE(inner.writes, 6u);
+    }
+    EXPECT_EQ(inner.writes, 7u);
+    EXPECT_EQ(inner.Length(), 400u);
+
+    ASSERT_TRUE(inner.Seek(0, StreamOrigin::Start));
+    for (u32 i = 0; i < 100; ++i) {
+        u32 value = ~0u;
+        ASSERT_EQ(inner.Read(&value, sizeof(value)), sizeof(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(TestBufferedStream, LargeWritesBypassTheBuffer) {
+    CountingStream inner;
+    BufferedWriter writer(inner, 64);
+    const auto small = Pattern(10);
+    const auto large = Pattern(1000);
+    ASSERT_EQ(writer.Write(small.data(), small.size()), small.size());
+    EXPECT_EQ(inner.writes, 0u);
+    ASSERT_EQ(writer.Write(large.data(), large.size()), large.size());
+    // the buffered bytes go first so the order is kept
+    EXPECT_EQ(inner.writes, 2u);
+    EXPECT_TRUE(writer.Flush());
+    EXPECT_EQ(inner.writes, 2u);
+    EXPECT_EQ(writer.Tell(), 1010u);
+}
+
+TEST(TestBufferedStream, SeekFlushesPendingWrites) {
+    CountingStream inner;
+    BufferedWriter writer(inner, 64);
+    const u32 a = 1, b = 2;
+    ASSERT_EQ(writer.Write(&a, sizeof(a)), sizeof(a));
+    ASSERT_EQ(writer.Write(&a, sizeof(a)), sizeof(a));
+    ASSERT_TRUE(writer.Seek(0, StreamOrigin::Start));
+    EXPECT_EQ(inner.writes, 1u);
+    EXPECT_EQ(writer.Tell(), 0u);
+    ASSERT_EQ(writer.Write(&b, sizeof(b)), sizeof(b));
+    EXPECT_TRUE(writer.Flush());
+
+    ASSERT_TRUE(inner.Seek(0, StreamOrigin::Start));
+    u32 values[2]{};
+    ASSERT_EQ(inner.Read(values, sizeof(values)), sizeof(values));
+    EXPECT_EQ(values[0], b);
+    EXPECT_EQ(values[1], a);
+}
+
+TEST(TestBufferedStream, FlushReportsOnlyItsOwnWrite) {
+    CountingStream inner;
+    BufferedWriter writer(inner, 64);
+    const u32 a = 1;
+    ASSERT_EQ(writer.Write(&a, sizeof(a)), sizeof(a));
+    inner.failWrites = true;
+    EXPECT_FALSE(writer.Flush());
+    EXPECT_FALSE(writer.IsGood());
+
+    // the failure stays in IsGood, later flushes, seeks and resizes don't repeat it
+    inner.failWrites = false;
+    EXPECT_TRUE(writer.Flush());
+    ASSERT_EQ(writer.Write(&a, sizeof(a)), sizeof(a));
+    EXPECT_TRUE(writer.Seek(0, StreamOrigin::End));
+    EXPECT_TRUE(writer.Resize(sizeof(a)));
+    EXPECT_FALSE(writer.IsGood());
+}
+
+TEST(TestBufferedStream, CoalescesSmallReads) {
+    CountingStream inner;
+    const auto bytes = Pattern(1000);
+    ASSERT_EQ(inner.Write(bytes.data(), bytes.size()), bytes.size());
+    ASSERT_TRUE(inner.Seek(0, StreamOrigin::Start));
+
+    BufferedReader reader(inner, 128);
+    eastl::vector<u8> out(bytes.size());
+    for (usize i = 0; i < out.size(); i += 10) {
+        ASSERT_EQ(reader.Read(out.data() + i, 10), 10u);
+        EXPECT_EQ(reader.Tell(), i + 10);
+    }
+    EXPECT_EQ(out, bytes);
+    EXPECT_LE(inner.reads, 8u);
+
+    u8 extra = 0;
+    EXPECT_EQ(reader.Read(&extra, 1), 0u);
+}
+
+TEST(TestBufferedStream, ReadsAcrossBufferBoundaries) {
+    CountingStream inner;
+    const auto bytes = Pattern(1000);
+    ASSERT_EQ(inner.Write(bytes.data(), bytes.size()), bytes.size());
+    ASSERT_TRUE(inner.Seek(0, StreamOrigin::Start));
+
+    BufferedReader reader(inner, 64);
+    eastl::vector<u8> out(bytes.size());
+    ASSERT_EQ(reader.Read(out.data(), 3), 3u);
+    ASSERT_EQ(reader.Read(out.data() + 3, 100), 100u);
+    ASSERT_EQ(reader.Read(out.data() + 103, 50), 50u);
+    // asks for more than is left
+    EXPECT_EQ(reader.Read(out.data() + 153, 2000), 847u);
+    EXPECT_EQ(out, bytes);
+    EXPECT_EQ(reader.Tell(), 1000u);
+}
+
+TEST(TestBufferedStream, SeekWithinAndOutsideTheBuffer) {
+    CountingStream inner;
+    const auto bytes = Pattern(1000);
+    ASSERT_EQ(inner.Write(bytes.data(), bytes.size()), bytes.size());
+    ASSERT_TRUE(inner.Seek(0, StreamOrigin::Start));
+
+    BufferedReader reader(inner, 128);
+    u8 value = 0;
+    ASSERT_EQ(reader.Read(&value, 1), 1u);
+    const usize readsAfterFill = inner.reads;
+
+    ASSERT_TRUE(reader.Seek(100, StreamOrigin::Start));
+    ASSERT_EQ(reader.Read(&value, 1), 1u);
+    EXPECT_EQ(value, bytes[100]);
+    ASSERT_TRUE(reader.Seek(-51, StreamOrigin::Current));
+    ASSERT_EQ(reader.Read(&value, 1), 1u);
+    EXPECT_EQ(value, bytes[50]);
+    EXPECT_EQ(inner.reads, readsAfterFill);
+
+    ASSERT_TRUE(reader.Seek(700, StreamOrigin::Start));
+    EXPECT_EQ(reader.Tell(), 700u);
+    ASSERT_EQ(reader.Read(&value, 1), 1u);
+    EXPECT_EQ(value, bytes[700]);
+    ASSERT_TRUE(reader.Seek(-201, StreamOrigin::Current));
+    ASSERT_EQ(reader.Read(&value, 1), 1u);
+    EXPECT_EQ(value, bytes[500]);
+    EXPECT_EQ(reader.Length(), 1000u);
+}
+
+TEST(TestBufferedStream, WorksUnderBinarySerializer) {
+    MemoryStream mem;
+    {
+        BufferedWriter writer(mem, 32);
+        BinarySerializer serializer(nullptr, &writer);
+        for (i32 i = 0; i < 50; ++i) {
+            serializer << i << static_cast<f32>(i) * 0.5f;
+        }
+        serializer << eastl::string("buffered");
+    }
+    ASSERT_TRUE(mem.Seek(0, StreamOrigin::Start));
+    BufferedReader reader(mem, 32);
+    BinarySerializer deserializer(&reader, nullptr);
+    for (i32 i = 0; i < 50; ++i) {
+        i32 integer = -1;
+        f32 real = -1.0f;
+        deserializer >> integer >> real;
+        EXPECT_EQ(integer, i);
+        EXPECT_EQ(real, static_cast<f32>(i) * 0.5f);
+    }
+    eastl::string text;
+    deserializer >> text;
+    EXPECT_EQ(text, "buffered");
+}
@@ -0,0 +1,89 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/Logging/FanOutLogStream.hpp>
+
+#include "CollectingLogStream.hpp"
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+TEST(TestFanOutLogStream, AppliesPerSinkSeverity) {
+    CollectingLogStream console;
+    CollectingLogStream file;
+    const FanOutLogSink sinks[] = { { &console, LogSeverity::Warn }, { &file, LogSeverity::Verbose } };
+    FanOutLogStream stream(sinks);
+    EXPECT_EQ(stream.SinkCount(), 2u);
+    EXPECT_EQ(stream.MinSeverity(), LogSeverity::Verbose);
+
+    stream.Log(LogSeverity::Info, "info");
+    stream.Log(LogSeverity::Error, "error");
+    ASSERT_EQ(console.messages.size(), 1u);
+    EXPECT_EQ(console.messages[0], "error");
+    ASSERT_EQ(file.messages.size(), 2u);
+    EXPECT_EQ(file.messages[0], "info");
+}
+
+TEST(TestFanOutLogStream, RespectsSinkMinSeverity) {
+    CollectingLogStream strict(LogSeverity::Error);
+    const FanOutLogSink sinks[] = { { &strict, LogSeverity::Debug } };
+    FanOutLogStream stream(sinks);
+    EXPECT_EQ(stream.MinSeverity(), LogSeverity::Error);
+    stream.Log(LogSeverity::Warn, "dropped");
+    EXPECT_TRUE(strict.messages.empty());
+
+    strict.minSeverity = LogSeverity::Verbose;
+    stream.Refresh();
+    EXPECT_EQ(stream.MinSeverity(), LogSeverity::Debug);
+    stream.Log(LogSeverity::Warn, "kept");
+    EXPECT_EQ(strict.messages.size(), 1u);
+}
+
+TEST(TestFanOutLogStream, ChangesSeverityAtRuntime) {
+    CollectingLogStream first;
+    CollectingLogStream second;
+    const FanOutLogSink sinks[] = { { &first, LogSeverity::Info }, { &second, LogSeverity::Info } };
+    FanOutLogStream stream(sinks);
+    stream.SetMinSeverity(1, LogSeverity::Fatal);
+    stream.Log(LogSeverity::Error, "only first");
+    EXPECT_EQ(first.messages.size(), 1u);
+    EXPECT_TRUE(second.messages.empty());
+    EXPECT_EQ(stream.MinSeverity(), LogSeverity::Info);
+}
+
+TEST(TestFanOutLogStream, ForwardsCallSites) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    CollectingLogStream first;
+    CollectingLogStream second;
+    const FanOutLogSink sinks[] = { { &first }, { &second } };
+    FanOutLogStream stream(sinks);
+    PYRO_LOG_ERROR(&stream, "code {}", 7);
+    ASSERT_EQ(first.sites.size(), 1u);
+    ASSERT_EQ(second.sites.size(), 1u);
+    EXPECT_EQ(first.sites[0], second.sites[0]);
+    EXPECT_EQ(second.messages[0], "code 7");
+}
@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logging/FlightRecorderLogStream.hpp>
+#include <PyroCommon/Logging/FlightRecorderReader.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    eastl::string TempPath(const char* name) {
+        return (std::filesystem::temp_directory_path() / name).string().c_str();
+    }
+
+    // Keeps the file open while the records are inspected
+    struct RecordedLog {
+        explicit RecordedLog(const eastl::string& path)
+            : file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly), reader(file) {
+            EXPECT_TRUE(reader.IsValid());
+        }
+
+        FileStream file;
+        FlightRecorderReader reader;
+    };
+} // namespace
+
+TEST(TestFlightRecorder, RoundTripsRecords) {
+    const eastl::string path = TempPath("pyro_flight_roundtrip.bin");
+    {
+        FlightRecorderLogStream recorder(path, LogSeverity::Debug, 8);
+        ASSERT_TRUE(recorder.IsGood());
+        recorder.Log(LogSeverity::Verbose, "filtered");
+        recorder.Log(LogSeverity::Info, "first");
+        recorder.Log(LogSeverity::Error, "second one", 6);
+    }
+    RecordedLog log(path);
+    auto records = log.reader.Records();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].sequence, 0u);
+    EXPECT_EQ(records[0].severity, LogSeverity::Info);
+    EXPECT_EQ(records[0].message, "first");
+    EXPECT_EQ(records[1].severity, LogSeverity::Error);
+    EXPECT_EQ(records[1].message, "second");
+    EXPECT_LE(records[0].timestamp, records[1].timestamp);
+    EXPECT_LE(log.reader.StartTime(), records[0].timestamp);
+}
+
+TEST(TestFlightRecorder, KeepsTheMostRecentRecords) {
+    const eastl::string path = TempPath("pyro_flight_wrap.bin");
+    {
+        FlightRecorderLogStream recorder(path, LogSeverity::Verbose, 8);
+        for (u32 i = 0; i < 20; ++i) {
+            recorder.Log(LogSeverity::Info, eastl::to_string(i).c_str());
+        }
+    }
+    RecordedLog log(path);
+    EXPECT_EQ(log.reader.LoggedCount(), 20u);
+    auto records = log.reader.Records();
+    ASSERT_EQ(records.size(), 8u);
+    for (u32 i = 0; i < 8; ++i) {
+        EXPECT_EQ(records[i].sequence, 12u + i);
+        EXPECT_EQ(records[i].message, eastl::to_string(12 + i));
+    }
+    auto last = log.reader.LastRecords(3);
+    ASSERT_EQ(last.size(), 3u);
+    EXPECT_EQ(last[0].message, "17");
+    EXPECT_EQ(log.reader.LastRecords(100).size(), 8u);
+}
+
+TEST(TestFlightRecorder, TruncatesLongMessages) {
+    const eastl::string path = TempPath("pyro_flight_truncate.bin");
+    {
+        FlightRecorderLogStream recorder(path, LogSeverity::Verbose, 4, 64);
+        recorder.Log(LogSeverity::Warn, eastl::string(100, 'x').c_str());
+    }
+    RecordedLog log(path);
+    ASSERT_EQ(log.reader.Records().size(), 1u);
+    EXPECT_EQ(log.reader.Records()[0].message, eastl::string(64 - sizeof(internal::FlightRecorderRecordHeader), 'x'));
+}
+
+TEST(TestFlightRecorder, SkipsRecordsTornByACrash) {
+    const eastl::string path = TempPath("pyro_flight_torn.bin");
+    {
+        FlightRecorderLogStream recorder(path, LogSeverity::Verbose, 4);
+        recorder.Log(LogSeverity::Info, "complete");
+        recorder.Log(LogSeverity::Info, "torn");
+    }
+    {
+        // marks the second record as still being written
+        FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadWrite);
+        const u64 busy = internal::FLIGHT_RECORDER_BUSY;
+        ASSERT_TRUE(file.Seek(sizeof(internal::FlightRecorderFileHeader) + FlightRecorderLogStream::DEFAULT_RECORD_SIZE, StreamOrigin::Start));
+        ASSERT_EQ(file.Write(&busy, sizeof(busy)), sizeof(busy));
+    }
+    RecordedLog log(path);
+    ASSERT_EQ(log.reader.Records().size(), 1u);
+    EXPECT_EQ(log.reader.Records()[0].message, "complete");
+}
+
+TEST(TestFlightRecorder, SurvivesProcessCrash) {
+    const eastl::string path = TempPath("pyro_flight_crash.bin");
+    EXPECT_DEATH(
+        {
+            // never destroyed, the process dies with the ring still mapped
+            auto* recorder = new FlightRecorderLogStream(path, LogSeverity::Verbose, 16);
+            for (u32 i = 0; i < 40; ++i) {
+                recorder->Log(LogSeverity::Info, eastl::to_string(i).c_str());
+            }
+            recorder->Log(LogSeverity::Fatal, "about to crash");
+            abort();
+        },
+        "");
+    RecordedLog log(path);
+    auto last = log.reader.LastRecords(2);
+    ASSERT_EQ(last.size(), 2u);
+    EXPECT_EQ(last[0].message, "39");
+    EXPECT_EQ(last[1].message, "about to crash");
+    EXPECT_EQ(last[1].severity, LogSeverity::Fatal);
+}
+
+TEST(TestFlightRecorder, ConcurrentWritersKeepRecordsIntact) {
+    const eastl::string path = TempPath("pyro_flight_threads.bin");
+    u64 dropped = 0;
+    {
+        FlightRecorderLogStream recorder(path, LogSeverity::Verbose, 64);
+        eastl::vector<std::thread> threads;
+        for (u32 t = 0; t < 4; ++t) {
+            threads.emplace_back([&recorder, t] {
+                for (u32 i = 0; i < 2000; ++i) {
+                    const eastl::string message = "thread " + eastl::to_string(t) + " message " + eastl::to_string(i);
+                    recorder.Log(LogSeverity::Info, message.c_str(), message.size());
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        dropped = recorder.DroppedCount();
+    }
+    RecordedLog log(path);
+    EXPECT_EQ(log.reader.LoggedCount(), 8000u);
+    auto records = log.reader.Records();
+    ASSERT_EQ(records.size(), 64u);
+    for (usize i = 0; i < records.size(); ++i) {
+        EXPECT_TRUE(records[i].message.starts_with("thread ")) << records[i].message.c_str();
+        // a record whose writer was dropped keeps the message from an earlier lap
+        if (dropped == 0) {
+            EXPECT_GE(records[i].sequence, 8000u - 64u);
+        }
+        if (i > 0) {
+            EXPECT_LT(records[i - 1].sequence, records[i].sequence);
+        }
+    }
+}
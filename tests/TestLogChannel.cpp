@@ -0,0 +1,205 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/CommandLineParser.hpp>
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/Logging/LogChannel.hpp>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    class CountingLogStream : public ILogStream {
+    public:
+        void Log(LogSeverity, const char* message) override { messages.emplace_back(message); }
+        LogSeverity MinSeverity() const override {
+            ++minSeverityCalls;
+            return minSeverity;
+        }
+        const char* Name() const override { return "Counting"; }
+
+        eastl::vector<eastl::string> messages;
+        LogSeverity minSeverity = LogSeverity::Verbose;
+        mutable u32 minSeverityCalls = 0;
+    };
+} // namespace
+
+TEST(TestLogChannel, SameNameSameChannel) {
+    LogChannel& first = LogChannelRegistry::Get("test.identity");
+    LogChannel& second = LogChannelRegistry::Get("test.identity");
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(LogChannelRegistry::Find("test.identity"), &first);
+    EXPECT_EQ(LogChannelRegistry::Find("test.missing"), nullptr);
+    EXPECT_STREQ(first.Name(), "test.identity");
+}
+
+TEST(TestLogChannel, DisabledWithoutStream) {
+    LogChannel& channel = LogChannelRegistry::Get("test.nostream");
+    EXPECT_EQ(channel.Stream(), nullptr);
+    EXPECT_FALSE(channel.IsEnabled(LogSeverity::Fatal));
+    PYRO_LOG_FATAL(channel, "goes nowhere");
+}
+
+TEST(TestLogChannel, CachedSeverityAvoidsVirtualCalls) {
+    CountingLogStream stream;
+    LogChannel& channel = LogChannelRegistry::Get("test.cached");
+    channel.SetStream(&stream);
+    channel.SetMinSeverity(LogSeverity::Warn);
+
+    const u32 callsAfterSetup = stream.minSeverityCalls;
+    for (u32 i = 0; i < 10; ++i) {
+        PYRO_LOG_ERROR(channel, "error {}", i);
+        PYRO_LOG_INFO(channel, "info {}", i);
+    }
+    EXPECT_EQ(stream.minSeverityCalls, callsAfterSetup);
+    ASSERT_EQ(stream.messages.size(), 10u);
+    EXPECT_EQ(stream.messages[9], "error 9");
+    channel.SetStream(nullptr);
+}
+
+TEST(TestLogChannel, StreamSeverityRaisesChannelSeverity) {
+    CountingLogStream stream;
+    stream.minSeverity = LogSeverity::Error;
+    LogChannel& channel = LogChannelRegistry::Get("test.streamfloor");
+    channel.SetStream(&stream);
+    channel.SetMinSeverity(LogSeverity::Verbose);
+    EXPECT_FALSE(channel.IsEnabled(LogSeverity::Warn));
+    EXPECT_TRUE(channel.IsEnabled(LogSeverity::Error));
+
+    stream.minSeverity = LogSeverity::Info;
+    LogChannelRegistry::Refresh();
+    EXPECT_TRUE(channel.IsEnabled(LogSeverity::Info));
+    channel.SetStream(nullptr);
+}
+
+TEST(TestLogChannel, ArgumentsNotEvaluatedWhenDisabled) {
+    CountingLogStream stream;
+    LogChannel& channel = LogChannelRegistry::Get("test.lazy");
+    channel.SetStream(&stream);
+    channel.Disable();
+
+    u32 evaluated = 0;
+    auto count = [&]() { return ++evaluated; };
+    PYRO_LOG_FATAL(channel, "{}", count());
+    EXPECT_EQ(evaluated, 0u);
+    EXPECT_TRUE(stream.messages.empty());
+
+    channel.SetMinSeverity(LogSeverity::Fatal);
+    PYRO_LOG_FATAL(channel, "{}", count());
+    EXPECT_EQ(evaluated, 1u);
+    EXPECT_EQ(stream.messages.size(), 1u);
+    channel.SetStream(nullptr);
+}
+
+TEST(TestLogChannel, DefaultsApplyUntilOverridden) {
+    CountingLogStream stream;
+    LogChannel& channel = LogChannelRegistry::Get("test.defaults");
+    LogChannelRegistry::SetDefaultStream(&stream);
+    LogChannelRegistry::SetDefaultSeverity(LogSeverity::Error);
+    EXPECT_EQ(channel.Stream(), &stream);
+    EXPECT_FALSE(channel.IsEnabled(LogSeverity::Info));
+
+    channel.SetMinSeverity(LogSeverity::Info);
+    EXPECT_TRUE(channel.IsEnabled(LogSeverity::Info));
+    channel.ResetMinSeverity();
+    EXPECT_FALSE(channel.IsEnabled(LogSeverity::Info));
+
+    Logger::LogFmt(LogSeverity::Error, channel, "through {}", "LogFmt");
+    ASSERT_EQ(stream.messages.size(), 1u);
+    EXPECT_EQ(stream.messages[0], "through LogFmt");
+
+    LogChannelRegistry::SetDefaultSeverity(LogSeverity::Verbose);
+    LogChannelRegistry::SetDefaultStream(nullptr);
+}
+
+TEST(TestLogChannel, ConfiguresFromCommandLine) {
+    CountingLogStream stream;
+    LogChannel& net = LogChannelRegistry::Get("test.net");
+    net.SetStream(&stream);
+    net.SetMinSeverity(LogSeverity::Verbose);
+
+    CommandLineParser options({ "-log.test.net=warn", "-log.test.later=Off", "-log.test.bad=Loud", "-unrelated=1" });
+    EXPECT_EQ(LogChannelRegistry::Configure(options), 2u);
+
+    EXPECT_FALSE(net.IsEnabled(LogSeverity::Info));
+    EXPECT_TRUE(net.IsEnabled(LogSeverity::Warn));
+    // configuring a channel before anything uses it creates it
+    LogChannel* later = LogChannelRegistry::Find("test.later");
+    ASSERT_NE(later, nullptr);
+    later->SetStream(&stream);
+    EXPECT_FALSE(later->IsEnabled(LogSeverity::Fatal));
+    EXPECT_EQ(LogChannelRegistry::Find("test.bad"), nullptr);
+
+    net.SetStream(nullptr);
+    later->SetStream(nullptr);
+}
+
+TEST(TestLogChannel, DefaultOffCoversLaterChannels) {
+    CountingLogStream stream;
+    LogChannelRegistry::SetDefaultStream(&stream);
+
+    CommandLineParser options({ "-log=Off" });
+    EXPECT_EQ(LogChannelRegistry::Configure(options), 1u);
+    // created after -log=Off was applied, still has no severity of its own
+    LogChannel& created = LogChannelRegistry::Get("test.default.off");
+    EXPECT_FALSE(created.IsEnabled(LogSeverity::Fatal));
+
+    LogChannelRegistry::SetDefaultSeverity(LogSeverity::Info);
+    EXPECT_TRUE(created.IsEnabled(LogSeverity::Info));
+    LogChannelRegistry::SetDefaultSeverity(LogSeverity::Verbose);
+    LogChannelRegistry::SetDefaultStream(nullptr);
+}
+
+TEST(TestLogChannel, ChannelOptionWinsOverDefault) {
+    CountingLogStream stream;
+    LogChannelRegistry::SetDefaultStream(&stream);
+
+    // both orders, the options are kept in a hash map either way
+    for (const auto& arguments : { eastl::vector<eastl::string>{ "-log=Off", "-log.test.wins=Info" },
+             eastl::vector<eastl::string>{ "-log.test.wins=Info", "-log=Off" } }) {
+        CommandLineParser options(arguments);
+        EXPECT_EQ(LogChannelRegistry::Configure(options), 2u);
+        LogChannel* wins = LogChannelRegistry::Find("test.wins");
+        ASSERT_NE(wins, nullptr);
+        EXPECT_TRUE(wins->IsEnabled(LogSeverity::Info));
+        EXPECT_FALSE(wins->IsEnabled(LogSeverity::Debug));
+        EXPECT_FALSE(LogChannelRegistry::Get("test.loses").IsEnabled(LogSeverity::Fatal));
+        wins->ResetMinSeverity();
+    }
+    LogChannelRegistry::SetDefaultSeverity(LogSeverity::Verbose);
+    LogChannelRegistry::SetDefaultStream(nullptr);
+}
+
+TEST(TestLogChannel, ParsesSeverityNames) {
+    LogSeverity severity = LogSeverity::Verbose;
+    bool enabled = false;
+    ASSERT_TRUE(LogChannelRegistry::ParseSeverity("TRACE", severity, enabled));
+    EXPECT_EQ(severity, LogSeverity::Trace);
+    EXPECT_TRUE(enabled);
+    ASSERT_TRUE(LogChannelRegistry::ParseSeverity("off", severity, enabled));
+    EXPECT_FALSE(enabled);
+    EXPECT_FALSE(LogChannelRegistry::ParseSeverity("", severity, enabled));
+    EXPECT_FALSE(LogChannelRegistry::ParseSeverity("warning", severity, enabled));
+}
@@ -0,0 +1,79 @@
+#include <PyroCommon/Logger.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+// Built as its own executable with the log floor raised to Warn, see tests/CMakeLists.txt
+static_assert(PyroshockStudios::Logger::MIN_SEVERITY == PyroshockStudios::LogSeverity::Warn,
+              "TestsLogStripping must be built with PYRO_COMMON_MIN_LOG_SEVERITY=Warn");
+
+using namespace PyroshockStudios;
+using namespace PyroshockStudios::Types;
+using ::testing::_;
+using ::testing::Return;
+using ::testing::StrEq;
+
+class MockLogStream : public ILogStream {
+public:
+    MOCK_METHOD(void, Log, (LogSeverity severity, const char* message), (override));
+    MOCK_METHOD(LogSeverity, MinSeverity, (), (const, override));
+    MOCK_METHOD(const char*, Name, (), (const, override));
+};
+
+TEST(TestLogStripping, SeveritiesBelowFloorAreCompiledOut) {
+    EXPECT_FALSE(Logger::IsCompiledIn(LogSeverity::Verbose));
+    EXPECT_FALSE(Logger::IsCompiledIn(LogSeverity::Debug));
+    EXPECT_FALSE(Logger::IsCompiledIn(LogSeverity::Trace));
+    EXPECT_FALSE(Logger::IsCompiledIn(LogSeverity::Info));
+    EXPECT_TRUE(Logger::IsCompiledIn(LogSeverity::Warn));
+    EXPECT_TRUE(Logger::IsCompiledIn(LogSeverity::Error));
+    EXPECT_TRUE(Logger::IsCompiledIn(LogSeverity::Fatal));
+}
+
+TEST(TestLogStripping, MacrosSkipArgumentsBelowFloor) {
+    MockLogStream stream;
+    EXPECT_CALL(stream, MinSeverity())
+        .WillRepeatedly(Return(LogSeverity::Verbose));
+    EXPECT_CALL(stream, Log(LogSeverity::Warn, StrEq("4")));
+    EXPECT_CALL(stream, Log(LogSeverity::Error, StrEq("5")));
+
+    u32 evaluated = 0;
+    auto count = [&]() { return ++evaluated; };
+    PYRO_LOG_VERBOSE(&stream, "{}", count());
+    PYRO_LOG_DEBUG(&stream, "{}", count());
+    PYRO_LOG_TRACE(&stream, "{}", count());
+    PYRO_LOG_INFO(&stream, "{}", count());
+    EXPECT_EQ(evaluated, 0u);
+
+    evaluated = 3;
+    PYRO_LOG_WARN(&stream, "{}", count());
+    PYRO_LOG_ERROR(&stream, "{}", count());
+    EXPECT_EQ(evaluated, 5u);
+}
+
+TEST(TestLogStripping, MacrosSkipTargetBelowFloor) {
+    // the stream expression isn't evaluated either, so a compiled out call never touches it
+    u32 evaluated = 0;
+    auto target = [&]() -> ILogStream* {
+        ++evaluated;
+        return nullptr;
+    };
+    PYRO_LOG_INFO(target(), "unused");
+    EXPECT_EQ(evaluated, 0u);
+    PYRO_LOG_WARN(target(), "unused");
+    EXPECT_EQ(evaluated, 1u);
+}
+
+TEST(TestLogStripping, FunctionsDropSeveritiesBelowFloor) {
+    MockLogStream stream;
+    EXPECT_CALL(stream, MinSeverity())
+        .WillRepeatedly(Return(LogSeverity::Verbose));
+    EXPECT_CALL(stream, Log(LogSeverity::Warn, StrEq("w")));
+    EXPECT_CALL(stream, Log(LogSeverity::Fatal, StrEq("f")));
+
+    Logger::Verbose(&stream, "v");
+    Logger::Debug(&stream, "d");
+    Logger::Trace(&stream, "t");
+    Logger::Info(&stream, "i");
+    Logger::Warn(&stream, "w");
+    Logger::Fatal(&stream, "f");
+}
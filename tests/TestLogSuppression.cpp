@@ -0,0 +1,286 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/Logging/LogSuppression.hpp>
+
+#include "CollectingLogStream.hpp"
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    class TestLogSuppression : public ::testing::Test {
+    protected:
+        void SetUp() override { mPrevious = LogSuppression::Config(); }
+        void TearDown() override { LogSuppression::SetConfig(mPrevious); }
+
+        static void Configure(u32 ratePerSecond, u32 burst, u32 coalesceWindowMs) {
+            LogSuppressionConfig config;
+            config.ratePerSecond = ratePerSecond;
+            config.burst = burst;
+            config.coalesceWindowMs = coalesceWindowMs;
+            // the tests storm with PYRO_LOG_ERROR, which the default exempts
+            config.exemptSeverity = LogSeverity::Fatal;
+            LogSuppression::SetConfig(config);
+        }
+
+    private:
+        LogSuppressionConfig mPrevious;
+    };
+
+    // one call site for every message, suppression is tracked per site
+    void LogFromOneSite(ILogStream* stream, const char* text, u32 value) {
+        PYRO_LOG_ERROR(stream, "{} {}", text, value);
+    }
+
+    LogSuppressionStats StatsOfSite(const char* format) {
+        for (const LogSiteSuppressionStats& site : LogSuppression::SiteStats()) {
+            if (eastl::string_view(site.site->format) == format)
+                return site.stats;
+        }
+        return {};
+    }
+} // namespace
+
+TEST_F(TestLogSuppression, CoalescesRepeatedMessages) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    CollectingLogStream stream;
+    for (u32 i = 0; i < 100; ++i) {
+        LogFromOneSite(&stream, "coalesced", 1);
+    }
+    ASSERT_EQ(stream.messages.size(), 1u);
+
+    LogFromOneSite(&stream, "coalesced", 2);
+    ASSERT_EQ(stream.messages.size(), 3u);
+    EXPECT_EQ(stream.messages[0], "coalesced 1");
+    EXPECT_TRUE(stream.messages[1].starts_with("previous message repeated 99 times in the last "));
+    EXPECT_EQ(stream.messages[2], "coalesced 2");
+    // the notice is attributed to the call site that was suppressed
+    EXPECT_EQ(stream.sites[1], stream.sites[0]);
+    EXPECT_GE(StatsOfSite("{} {}").coalesced, 99u);
+}
+
+TEST_F(TestLogSuppression, RepeatsAfterWindowExpires) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 1);
+    CollectingLogStream stream;
+    LogFromOneSite(&stream, "window", 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    LogFromOneSite(&stream, "window", 0);
+    EXPECT_EQ(stream.messages.size(), 2u);
+}
+
+TEST_F(TestLogSuppression, RateLimitsDistinctMessages) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(50, 5, 0);
+    CollectingLogStream stream;
+    const u64 rateLimitedBefore = LogSuppression::Stats().rateLimited;
+    for (u32 i = 0; i < 100; ++i) {
+        LogFromOneSite(&stream, "distinct", i);
+    }
+    // the burst, plus whatever the bucket refilled while looping
+    const usize logged = stream.messages.size();
+    EXPECT_GE(logged, 5u);
+    EXPECT_LT(logged, 20u);
+    EXPECT_EQ(LogSuppression::Stats().rateLimited - rateLimitedBefore, 100u - logged);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    LogFromOneSite(&stream, "distinct", 100);
+    ASSERT_EQ(stream.messages.size(), logged + 2);
+    EXPECT_EQ(stream.messages[logged], fmt::format("{} messages dropped by the rate limit of 50/s", 100u - logged).c_str());
+    EXPECT_EQ(stream.messages[logged + 1], "distinct 100");
+}
+
+TEST_F(TestLogSuppression, ExemptSeverityIsNeverSuppressed) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Fatal))
+        GTEST_SKIP();
+    Configure(1, 1, 60'000);
+    CollectingLogStream stream;
+    for (u32 i = 0; i < 10; ++i) {
+        PYRO_LOG_FATAL(&stream, "always");
+    }
+    EXPECT_EQ(stream.messages.size(), 10u);
+}
+
+TEST_F(TestLogSuppression, SeparateSitesAreIndependent) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    CollectingLogStream stream;
+    for (u32 i = 0; i < 10; ++i) {
+        PYRO_LOG_ERROR(&stream, "first site");
+        PYRO_LOG_ERROR(&stream, "second site");
+    }
+    ASSERT_EQ(stream.messages.size(), 2u);
+    EXPECT_EQ(StatsOfSite("first site").coalesced, 9u);
+    EXPECT_EQ(StatsOfSite("second site").coalesced, 9u);
+}
+
+TEST_F(TestLogSuppression, ConcurrentStormStaysBounded) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    CollectingLogStream stream;
+    const u64 coalescedBefore = StatsOfSite("{} {}").coalesced;
+    eastl::vector<std::thread> threads;
+    for (u32 t = 0; t < 4; ++t) {
+        threads.emplace_back([&stream] {
+            for (u32 i = 0; i < 1000; ++i) {
+                LogFromOneSite(&stream, "storm", 0);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    usize passed = 0;
+    for (const eastl::string& message : stream.messages) {
+        passed += message == "storm 0";
+    }
+    // racing threads may each let a copy through, but every call is either logged or counted
+    EXPECT_LT(passed, 50u);
+    EXPECT_EQ(passed + (StatsOfSite("{} {}").coalesced - coalescedBefore), 4000u);
+}
+
+TEST_F(TestLogSuppression, FlushReportsEndedStorm) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    // static, FlushPending matches sites to streams by address
+    static CollectingLogStream stream;
+    static CollectingLogStream other;
+    for (u32 i = 0; i < 10; ++i) {
+        PYRO_LOG_ERROR(&stream, "ended {}", 0);
+    }
+    ASSERT_EQ(stream.messages.size(), 1u);
+
+    // nothing logs from the site again, the flush has to report it
+    LogSuppression::FlushPending(&other);
+    EXPECT_TRUE(other.messages.empty());
+    LogSuppression::FlushPending(&stream);
+    ASSERT_EQ(stream.messages.size(), 2u);
+    EXPECT_TRUE(stream.messages[1].starts_with("previous message repeated 9 times in the last "));
+    LogSuppression::FlushPending(&stream);
+    EXPECT_EQ(stream.messages.size(), 2u);
+}
+
+TEST_F(TestLogSuppression, RateLimitedMessageIsNotCoalescedAgainst) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(1, 1, 60'000);
+    static CollectingLogStream stream;
+    for (u32 i = 0; i < 4; ++i) {
+        // the first takes the only token
+        PYRO_LOG_ERROR(&stream, "limited {}", i == 0 ? 0 : 1);
+    }
+    // "limited 1" never reached the stream, so its copies are not repeats of it
+    EXPECT_EQ(StatsOfSite("limited {}").coalesced, 0u);
+    EXPECT_EQ(StatsOfSite("limited {}").rateLimited, 3u);
+
+    LogSuppression::FlushPending(&stream);
+    ASSERT_EQ(stream.messages.size(), 2u);
+    EXPECT_EQ(stream.messages[0], "limited 0");
+    EXPECT_EQ(stream.messages[1], "3 messages dropped by the rate limit of 1/s");
+}
+
+TEST_F(TestLogSuppression, DefaultNeverSuppressesWarnings) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Warn))
+        GTEST_SKIP();
+    LogSuppression::SetConfig({});
+    EXPECT_EQ(LogSuppression::Config().exemptSeverity, LogSeverity::Warn);
+    CollectingLogStream stream;
+    for (u32 i = 0; i < 100; ++i) {
+        PYRO_LOG_WARN(&stream, "warned");
+        PYRO_LOG_ERROR(&stream, "errored");
+    }
+    EXPECT_EQ(stream.messages.size(), 200u);
+}
+
+TEST_F(TestLogSuppression, ExpiredWindowIsReportedByNextSubmit) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(1, 1, 5);
+    CollectingLogStream stream;
+    for (u32 i = 0; i <= 10; ++i) {
+        if (i == 10) {
+            ASSERT_EQ(stream.messages.size(), 1u);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        // the last one finds the bucket still empty, it is dropped but the ended storm goes out without a Flush
+        PYRO_LOG_ERROR(&stream, "expired {}", i < 10 ? 0 : 1);
+    }
+    ASSERT_EQ(stream.messages.size(), 2u);
+    EXPECT_TRUE(stream.messages[1].starts_with("previous message repeated 9 times in the last "));
+}
+
+TEST_F(TestLogSuppression, StreamsAreSuppressedSeparately) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    static CollectingLogStream first;
+    static CollectingLogStream second;
+    for (u32 i = 0; i < 5; ++i) {
+        for (ILogStream* stream : { static_cast<ILogStream*>(&first), static_cast<ILogStream*>(&second) }) {
+            PYRO_LOG_ERROR(stream, "separate {}", 0);
+        }
+    }
+    // neither stream's copy is a repeat of the other's
+    ASSERT_EQ(first.messages.size(), 1u);
+    ASSERT_EQ(second.messages.size(), 1u);
+
+    LogSuppression::FlushPending(&second);
+    EXPECT_EQ(first.messages.size(), 1u);
+    ASSERT_EQ(second.messages.size(), 2u);
+    EXPECT_TRUE(second.messages[1].starts_with("previous message repeated 4 times in the last "));
+    LogSuppression::FlushPending(&first);
+    ASSERT_EQ(first.messages.size(), 2u);
+    EXPECT_TRUE(first.messages[1].starts_with("previous message repeated 4 times in the last "));
+}
+
+TEST_F(TestLogSuppression, RemovedStreamIsForgotten) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    Configure(0, 0, 60'000);
+    CollectingLogStream stream;
+    for (u32 i = 0; i < 3; ++i) {
+        PYRO_LOG_ERROR(&stream, "removed {}", 0);
+    }
+    LogSuppression::RemoveStream(&stream);
+    ASSERT_EQ(stream.messages.size(), 2u);
+    EXPECT_TRUE(stream.messages[1].starts_with("previous message repeated 2 times in the last "));
+
+    // nothing is left pointing at the stream, a flush of every site doesn't reach it
+    PYRO_LOG_ERROR(&stream, "removed {}", 0);
+    LogSuppression::RemoveStream(&stream);
+    LogSuppression::FlushPending();
+    ASSERT_EQ(stream.messages.size(), 3u);
+    EXPECT_EQ(stream.messages[2], "removed 0");
+}
@@ -73,3 +73,87 @@ TEST(TestLogger, AllSeveritiesCallLogCorrectly) {
     Logger::Error(&stream, "e");
     Logger::Fatal(&stream, "f");
 }
+
+class LengthAwareLogStream : public ILogStream {
+public:
+    void Log(LogSeverity severity, const char* message) override {
+        Log(severity, message, strlen(message));
+        ++unsizedCalls;
+    }
+    void Log(LogSeverity, const char* message, usize length) override {
+        last.assign(message, length);
+        lastLength = length;
+        terminated = message[length] == '\0';
+    }
+    LogSeverity MinSeverity() const override { return LogSeverity::Verbose; }
+    const char* Name() const override { return "LengthAware"; }
+
+    eastl::string last;
+    usize lastLength = 0;
+    bool terminated = false;
+    u32 unsizedCalls = 0;
+};
+
+TEST(TestLogger, PassesMessageLength) {
+    LengthAwareLogStream stream;
+    Logger::Info(&stream, "{} + {} = {}", 2, 2, 4);
+    EXPECT_EQ(stream.last, "2 + 2 = 4");
+    EXPECT_EQ(stream.lastLength, 9u);
+    EXPECT_TRUE(stream.terminated);
+    EXPECT_EQ(stream.unsizedCalls, 0u);
+}
+
+TEST(TestLogger, FormatsMessagesLargerThanInlineBuffer) {
+    LengthAwareLogStream stream;
+    eastl::string longText(2000, 'z');
+    Logger::Info(&stream, "<{}>", longText.c_str());
+    EXPECT_EQ(stream.lastLength, 2002u);
+    EXPECT_EQ(stream.last, "<" + longText + ">");
+    EXPECT_TRUE(stream.terminated);
+}
+
+class SiteLogStream : public ILogStream {
+public:
+    void Log(LogSeverity, const char* message) override { last = message; }
+    void Log(const LogSite& site, const char* message, usize) override {
+        lastSite = &site;
+        last = message;
+    }
+    LogSeverity MinSeverity() const override { return LogSeverity::Verbose; }
+    const char* Name() const override { return "Site"; }
+
+    const LogSite* lastSite = nullptr;
+    eastl::string last;
+};
+
+TEST(TestLogger, MacrosCarryStaticCallSite) {
+    SiteLogStream stream;
+    const u32 line = __LINE__ + 1;
+    PYRO_LOG_ERROR(&stream, "code {}", 7);
+
+    ASSERT_NE(stream.lastSite, nullptr);
+    EXPECT_EQ(stream.last, "code 7");
+    EXPECT_EQ(stream.lastSite->severity, LogSeverity::Error);
+    EXPECT_EQ(stream.lastSite->line, line);
+    EXPECT_STREQ(stream.lastSite->format, "code {}");
+    EXPECT_NE(strstr(stream.lastSite->file, "TestLogger.cpp"), nullptr);
+    EXPECT_NE(strstr(stream.lastSite->function, "MacrosCarryStaticCallSite"), nullptr);
+
+    // the site is a static, the same call logs the same one
+    const LogSite* first = nullptr;
+    for (u32 i = 0; i < 2; ++i) {
+        PYRO_LOG_FATAL(&stream, "no arguments");
+        if (!first) {
+            first = stream.lastSite;
+        }
+    }
+    EXPECT_EQ(stream.lastSite, first);
+}
+
+TEST(TestLogger, MacrosRespectStreamSeverity) {
+    MockLogStream stream;
+    EXPECT_CALL(stream, MinSeverity())
+        .WillRepeatedly(Return(LogSeverity::Error));
+    EXPECT_CALL(stream, Log(_, _)).Times(0);
+    PYRO_LOG_WARN(&stream, "filtered");
+}
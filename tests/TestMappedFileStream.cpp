@@ -0,0 +1,174 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/FileStream.hpp>
+#include <PyroCommon/Stream/MappedFileStream.hpp>
+
+#include <EASTL/vector.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    // Fresh file path per test, removed afterwards
+    class TestMappedFileStream : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mPath = (std::filesystem::temp_directory_path() / ("pyro_mapped_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".bin")).string().c_str();
+            std::filesystem::remove(mPath.c_str());
+        }
+        void TearDown() override { std::filesystem::remove(mPath.c_str()); }
+
+        void WriteFile(const eastl::vector<u8>& bytes) const {
+            FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::WriteOnly);
+            ASSERT_EQ(file.Write(bytes.data(), bytes.size()), bytes.size());
+        }
+
+        eastl::vector<u8> ReadFile() const {
+            FileStream file(mPath, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+            eastl::vector<u8> bytes(file.Length());
+            EXPECT_EQ(file.Read(bytes.data(), bytes.size()), bytes.size());
+            return bytes;
+        }
+
+        static eastl::vector<u8> Pattern(usize size) {
+            eastl::vector<u8> bytes(size);
+            for (usize i = 0; i < size; ++i) {
+                bytes[i] = static_cast<u8>(i * 13 + 5);
+            }
+            return bytes;
+        }
+
+        eastl::string mPath;
+    };
+} // namespace
+
+TEST_F(TestMappedFileStream, SpanSeesFileWithoutReading) {
+    const auto bytes = Pattern(10000);
+    WriteFile(bytes);
+
+    MappedFileStream stream(mPath, MappedFileStream::Mode::ReadOnly);
+    ASSERT_TRUE(stream.IsOpen());
+    EXPECT_EQ(stream.Length(), bytes.size());
+    const auto span = stream.Span();
+    ASSERT_EQ(span.size(), bytes.size());
+    EXPECT_TRUE(eastl::equal(span.begin(), span.end(), bytes.begin()));
+    EXPECT_TRUE(stream.WritableSpan().empty());
+    EXPECT_TRUE(stream.Advise(MappedFileStream::AccessHint::Sequential));
+}
+
+TEST_F(TestMappedFileStream, ReadAndSeekMatchFileStream) {
+    const auto bytes = Pattern(1000);
+    WriteFile(bytes);
+
+    MappedFileStream stream(mPath, MappedFileStream::Mode::ReadOnly);
+    u8 chunk[100];
+    ASSERT_EQ(stream.Read(chunk, sizeof(chunk)), sizeof(chunk));
+    EXPECT_EQ(chunk[99], bytes[99]);
+    EXPECT_EQ(stream.Tell(), 100u);
+
+    ASSERT_TRUE(stream.Seek(-10, StreamOrigin::End));
+    EXPECT_EQ(stream.Read(chunk, sizeof(chunk)), 10u);
+    EXPECT_EQ(chunk[0], bytes[990]);
+    EXPECT_EQ(stream.Read(chunk, sizeof(chunk)), 0u);
+
+    EXPECT_FALSE(stream.Seek(1, StreamOrigin::End));
+    EXPECT_FALSE(stream.Seek(-2000, StreamOrigin::Current));
+    ASSERT_TRUE(stream.Seek(-500, StreamOrigin::Current));
+    ASSERT_EQ(stream.Read(chunk, 1), 1u);
+    EXPECT_EQ(chunk[0], bytes[500]);
+
+    u8 byte = 0;
+    EXPECT_EQ(stream.Write(&byte, 1), 0u);
+    EXPECT_FALSE(stream.Resize(10));
+}
+
+TEST_F(TestMappedFileStream, WritesGrowTheMapping) {
+    const auto bytes = Pattern(300000);
+    {
+        MappedFileStream stream(mPath, MappedFileStream::Mode::WriteOnly);
+        ASSERT_TRUE(stream.IsOpen());
+        EXPECT_TRUE(stream.Span().empty());
+        // small pieces, so the mapping is grown and moved several times
+        for (usize i = 0; i < bytes.size(); i += 1000) {
+            ASSERT_EQ(stream.Write(bytes.data() + i, 1000), 1000u);
+        }
+        EXPECT_EQ(stream.Length(), bytes.size());
+        const auto span = stream.Span();
+        EXPECT_TRUE(eastl::equal(span.begin(), span.end(), bytes.begin()));
+        EXPECT_TRUE(stream.Flush());
+    }
+    // the spare room is cut off on close
+    EXPECT_EQ(ReadFile(), bytes);
+}
+
+TEST_F(TestMappedFileStream, ReadWriteKeepsExistingContents) {
+    WriteFile(Pattern(100));
+    {
+        MappedFileStream stream(mPath, MappedFileStream::Mode::ReadWrite);
+        ASSERT_TRUE(stream.Seek(50, StreamOrigin::Start));
+        const u8 patch[4] = { 1, 2, 3, 4 };
+        ASSERT_EQ(stream.Write(patch, sizeof(patch)), sizeof(patch));
+        stream.WritableSpan()[0] = 42;
+    }
+    auto expected = Pattern(100);
+    expected[0] = 42;
+    expected[50] = 1;
+    expected[51] = 2;
+    expected[52] = 3;
+    expected[53] = 4;
+    EXPECT_EQ(ReadFile(), expected);
+}
+
+TEST_F(TestMappedFileStream, ResizeAndGapsReadAsZero) {
+    {
+        MappedFileStream stream(mPath, MappedFileStream::Mode::WriteOnly);
+        const auto bytes = Pattern(64);
+        ASSERT_EQ(stream.Write(bytes.data(), bytes.size()), bytes.size());
+        ASSERT_TRUE(stream.Resize(16));
+        EXPECT_EQ(stream.Length(), 16u);
+        // the bytes cut off by the shrink must not come back
+        ASSERT_TRUE(stream.Resize(32));
+        ASSERT_TRUE(stream.Seek(48, StreamOrigin::Start));
+        const u8 last = 7;
+        ASSERT_EQ(stream.Write(&last, 1), 1u);
+        EXPECT_EQ(stream.Length(), 49u);
+    }
+    const auto contents = ReadFile();
+    ASSERT_EQ(contents.size(), 49u);
+    const auto bytes = Pattern(16);
+    EXPECT_TRUE(eastl::equal(bytes.begin(), bytes.end(), contents.begin()));
+    for (usize i = 16; i < 48; ++i) {
+        EXPECT_EQ(contents[i], 0) << i;
+    }
+    EXPECT_EQ(contents[48], 7);
+}
+
+TEST_F(TestMappedFileStream, MissingFileIsNotOpen) {
+    MappedFileStream stream(mPath, MappedFileStream::Mode::ReadOnly);
+    EXPECT_FALSE(stream.IsOpen());
+    EXPECT_EQ(stream.Length(), 0u);
+    u8 byte = 0;
+    EXPECT_EQ(stream.Read(&byte, 1), 0u);
+    EXPECT_FALSE(stream.Seek(0, StreamOrigin::Start));
+}
@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Core.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <string.h>
+
+using namespace PyroshockStudios;
+
+// The EASTL hook the overloads in MemoryOverload.hpp provide, defined by tests/main.cpp
+void* PYRO_CDECL operator new[](usize size, usize alignment, usize offset, const char* name, int flags, u32 debugFlags, const char* file, int line);
+
+namespace {
+    constexpr bool HAS_OVERLOAD_BACKEND =
+#if defined(PYRO_COMMON_USE_SNMALLOC) || defined(PYRO_COMMON_USE_SLAB_ALLOCATOR) || defined(PYRO_COMMON_TRACK_ALLOCATIONS)
+        true;
+#else
+        false;
+#endif
+} // namespace
+
+// Runs against whichever backend the build selected, snmalloc, the slab allocator or allocation tracking
+TEST(TestMemoryOverload, OffsetAlignmentContract) {
+    if constexpr (!HAS_OVERLOAD_BACKEND)
+        GTEST_SKIP() << "no allocator backend configured";
+    const usize alignments[] = { 1, 8, 16, 32, 64, 256, 4096 };
+    const usize offsets[] = { 0, 4, 8, 12, 24, 100, 4095 };
+    const usize sizes[] = { 1, 24, 200, 5000, 70000 };
+    for (usize alignment : alignments) {
+        for (usize offset : offsets) {
+            for (usize size : sizes) {
+                u8* ptr = static_cast<u8*>(operator new[](size, alignment, offset, "TestMemoryOverload", 0, 0, __FILE__, __LINE__));
+                ASSERT_NE(ptr, nullptr);
+                EXPECT_EQ(reinterpret_cast<uptr>(ptr + offset) % alignment, 0u)
+                    << "alignment " << alignment << " offset " << offset << " size " << size;
+                // the whole block must be usable, the sanitizers catch a short one
+                memset(ptr, 0xCD, size);
+                delete[] ptr;
+            }
+        }
+    }
+}
+
+TEST(TestMemoryOverload, ContainersUseAlignedHook) {
+    if constexpr (!HAS_OVERLOAD_BACKEND)
+        GTEST_SKIP() << "no allocator backend configured";
+    struct alignas(64) CacheLine {
+        u8 bytes[64];
+    };
+    eastl::vector<CacheLine> lines(100);
+    EXPECT_EQ(reinterpret_cast<uptr>(lines.data()) % 64, 0u);
+}
@@ -0,0 +1,135 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Memory.hpp>
+#include <PyroCommon/ObjectPool.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    struct PooledHandle : public RefCounted, public PoolAllocated {
+        explicit PooledHandle(i32 value, i32* destroyed = nullptr) : value(value), destroyed(destroyed) {}
+        ~PooledHandle() override {
+            if (destroyed) {
+                ++*destroyed;
+            }
+        }
+
+        i32 value;
+        i32* destroyed;
+    };
+
+    struct LargePooledHandle : public PooledHandle {
+        using PooledHandle::PooledHandle;
+        u8 payload[200] = {};
+    };
+} // namespace
+
+TEST(TestObjectPool, BlocksAreReused) {
+    void* first = ObjectPool::Allocate(40);
+    ObjectPool::Deallocate(first, 40);
+    void* second = ObjectPool::Allocate(40);
+    EXPECT_EQ(first, second);
+    ObjectPool::Deallocate(second, 40);
+}
+
+TEST(TestObjectPool, LargeSizesFallBackToHeap) {
+    void* block = ObjectPool::Allocate(ObjectPool::MAX_BLOCK_SIZE + 1);
+    ASSERT_NE(block, nullptr);
+    memset(block, 0xAB, ObjectPool::MAX_BLOCK_SIZE + 1);
+    ObjectPool::Deallocate(block, ObjectPool::MAX_BLOCK_SIZE + 1);
+}
+
+TEST(TestObjectPool, SharedRefCreateAndRelease) {
+    i32 destroyed = 0;
+    PooledHandle* address = nullptr;
+    {
+        SharedRef<PooledHandle> handle = SharedRef<PooledHandle>::Create(7, &destroyed);
+        address = handle.Get();
+        EXPECT_EQ(handle->value, 7);
+    }
+    EXPECT_EQ(destroyed, 1);
+
+    // the freed block is at the top of this thread's cache
+    SharedRef<PooledHandle> handle = SharedRef<PooledHandle>::Create(8);
+    EXPECT_EQ(handle.Get(), address);
+}
+
+TEST(TestObjectPool, DerivedTypesUseTheirOwnSizeClass) {
+    i32 destroyed = 0;
+    {
+        SharedRef<PooledHandle> handle = SharedRef<LargePooledHandle>::Create(3, &destroyed);
+        EXPECT_EQ(handle->value, 3);
+    }
+    EXPECT_EQ(destroyed, 1);
+}
+
+TEST(TestObjectPool, CrossThreadRelease) {
+    constexpr i32 kCount = 10000;
+    i32 destroyed = 0;
+
+    eastl::vector<SharedRef<PooledHandle>> handles;
+    for (i32 i = 0; i < kCount; ++i) {
+        handles.push_back(SharedRef<PooledHandle>::Create(i, &destroyed));
+    }
+
+    std::thread releaser([&handles]() {
+        handles.clear();
+        ObjectPool::FlushThreadCache();
+    });
+    releaser.join();
+    EXPECT_EQ(destroyed, kCount);
+
+    // blocks freed on the other thread are available again
+    for (i32 i = 0; i < kCount; ++i) {
+        handles.push_back(SharedRef<PooledHandle>::Create(i));
+    }
+    EXPECT_EQ(handles.back()->value, kCount - 1);
+}
+
+TEST(TestObjectPool, ConcurrentChurn) {
+    constexpr i32 kThreads = 4;
+    constexpr i32 kIterations = 20000;
+
+    eastl::vector<std::thread> threads;
+    for (i32 t = 0; t < kThreads; ++t) {
+        threads.emplace_back([]() {
+            eastl::vector<SharedRef<PooledHandle>> live;
+            for (i32 i = 0; i < kIterations; ++i) {
+                live.push_back(SharedRef<PooledHandle>::Create(i));
+                if (live.size() > 64) {
+                    live.erase(live.begin(), live.begin() + 32);
+                }
+            }
+            for (const auto& handle : live) {
+                EXPECT_GE(handle->value, 0);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,210 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logger.hpp>
+#include <PyroCommon/Logging/PerThreadLogStream.hpp>
+
+#include "CollectingLogStream.hpp"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+TEST(TestPerThreadLogStream, KeepsOrderPerThread) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks, 4096);
+
+    constexpr u32 THREADS = 8;
+    constexpr u32 MESSAGES = 2000;
+    eastl::vector<std::thread> threads;
+    for (u32 t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&stream, t]() {
+            for (u32 i = 0; i < MESSAGES; ++i) {
+                char message[32];
+                snprintf(message, sizeof(message), "%u %u", t, i);
+                stream.Log(LogSeverity::Info, message);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    stream.Flush();
+
+    ASSERT_EQ(sink.messages.size(), THREADS * MESSAGES);
+    EXPECT_EQ(stream.DroppedCount(), 0u);
+    u32 next[THREADS] = {};
+    for (const eastl::string& message : sink.messages) {
+        u32 thread = 0;
+        u32 index = 0;
+        ASSERT_EQ(sscanf(message.c_str(), "%u %u", &thread, &index), 2);
+        EXPECT_EQ(index, next[thread]++);
+    }
+}
+
+TEST(TestPerThreadLogStream, MergesThreadsInTimeOrder) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks, 4096, LogOverflowPolicy::Block, 1);
+
+    // the threads take turns, so each message happens after the previous one on another thread
+    constexpr u32 THREADS = 4;
+    constexpr u32 MESSAGES = 4000;
+    std::atomic<u32> turn = 0;
+    eastl::vector<std::thread> threads;
+    for (u32 t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (u32 i = t; i < MESSAGES; i += THREADS) {
+                while (turn.load(std::memory_order_acquire) != i) {
+                    std::this_thread::yield();
+                }
+                stream.Log(LogSeverity::Info, eastl::to_string(i).c_str());
+                turn.store(i + 1, std::memory_order_release);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    stream.Flush();
+
+    ASSERT_EQ(sink.messages.size(), MESSAGES);
+    for (u32 i = 0; i < MESSAGES; ++i) {
+        ASSERT_EQ(sink.messages[i], eastl::to_string(i));
+    }
+}
+
+TEST(TestPerThreadLogStream, DropsWhenThreadBufferIsFull) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks, 1024, LogOverflowPolicy::DropAndReport, 60'000);
+
+    // the collector gets stuck delivering the first message
+    sink.blocked = true;
+    stream.Log(LogSeverity::Error, "first");
+    const eastl::string filler(100, 'z');
+    for (u32 i = 0; i < 100; ++i) {
+        stream.Log(LogSeverity::Info, filler.c_str());
+    }
+    sink.blocked = false;
+    stream.Flush();
+
+    const u64 dropped = stream.DroppedCount();
+    EXPECT_GT(dropped, 0u);
+    // the report goes out with the pass that saw the drops, records stamped later may follow it
+    const eastl::string report = "[PerThreadLogStream] Thread buffer full, dropped " + eastl::to_string(dropped) + " messages";
+    EXPECT_EQ(eastl::count(sink.messages.begin(), sink.messages.end(), report), 1);
+    // everything not dropped arrives, plus the report
+    EXPECT_EQ(sink.messages.size() - 1 + dropped, 101u);
+}
+
+TEST(TestPerThreadLogStream, ReleasesBuffersOfExitedThreads) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks);
+    std::thread([&stream]() { stream.Log(LogSeverity::Info, "from a short-lived thread"); }).join();
+    EXPECT_EQ(stream.BufferCount(), 1u);
+
+    // the first pass delivers the message, the next one frees the drained ring
+    stream.Flush();
+    stream.Flush();
+    EXPECT_EQ(stream.BufferCount(), 0u);
+    ASSERT_EQ(sink.messages.size(), 1u);
+}
+
+TEST(TestPerThreadLogStream, ThreadOutlivesStream) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    std::atomic<bool> logged = false;
+    std::atomic<bool> destroyed = false;
+    std::thread thread;
+    {
+        PerThreadLogStream stream(sinks);
+        thread = std::thread([&]() {
+            stream.Log(LogSeverity::Info, "before");
+            logged = true;
+            while (!destroyed) {
+                std::this_thread::yield();
+            }
+            // exits after the stream is gone, its ring must not be touched
+        });
+        while (!logged) {
+            std::this_thread::yield();
+        }
+    }
+    destroyed = true;
+    thread.join();
+    ASSERT_EQ(sink.messages.size(), 1u);
+}
+
+namespace {
+    // Logs from a thread_local destructor that runs after the stream's own per-thread state is gone
+    struct LogsOnThreadExit {
+        ~LogsOnThreadExit() {
+            if (stream) {
+                // frees the ring the exiting thread handed back
+                stream->Flush();
+                stream->Flush();
+                stream->Log(LogSeverity::Info, "from a thread_local destructor");
+            }
+        }
+        PerThreadLogStream* stream = nullptr;
+    };
+    thread_local LogsOnThreadExit tLogsOnThreadExit;
+} // namespace
+
+TEST(TestPerThreadLogStream, DropsMessagesAfterThreadBuffersAreReleased) {
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks);
+    std::thread([&stream]() {
+        // constructed before the stream's thread_locals, so destroyed after them
+        tLogsOnThreadExit.stream = &stream;
+        stream.Log(LogSeverity::Info, "while running");
+    }).join();
+    stream.Flush();
+    EXPECT_EQ(stream.BufferCount(), 0u);
+    EXPECT_EQ(stream.DroppedCount(), 1u);
+    ASSERT_EQ(sink.messages.size(), 1u);
+    EXPECT_EQ(sink.messages[0], "while running");
+}
+
+TEST(TestPerThreadLogStream, ForwardsCallSites) {
+    if constexpr (!Logger::IsCompiledIn(LogSeverity::Error))
+        GTEST_SKIP();
+    CollectingLogStream sink;
+    ILogStream* sinks[] = { &sink };
+    PerThreadLogStream stream(sinks);
+    PYRO_LOG_ERROR(&stream, "code {}", 7);
+    stream.Flush();
+    ASSERT_EQ(sink.sites.size(), 1u);
+    EXPECT_EQ(sink.sites[0]->line, static_cast<u32>(__LINE__ - 3));
+    EXPECT_EQ(sink.messages[0], "code 7");
+}
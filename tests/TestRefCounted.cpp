@@ -0,0 +1,237 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Memory.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    template <typename Base>
+    struct CountedObject : public Base {
+        explicit CountedObject(eastl::atomic<i32>* destroyed) : destroyed(destroyed) {}
+        ~CountedObject() override {
+            destroyed->fetch_add(1);
+        }
+
+        eastl::atomic<i32>* destroyed;
+    };
+
+    template <typename Base>
+    void ExpectSingleThreadedLifetime() {
+        eastl::atomic<i32> destroyed = { 0 };
+        {
+            SharedRef<CountedObject<Base>> first = SharedRef<CountedObject<Base>>::Create(&destroyed);
+            {
+                SharedRef<CountedObject<Base>> second = first;
+                SharedRef<CountedObject<Base>> third = eastl::move(second);
+                EXPECT_EQ(third.Get(), first.Get());
+            }
+            EXPECT_EQ(destroyed.load(), 0);
+        }
+        EXPECT_EQ(destroyed.load(), 1);
+    }
+
+    using BiasedObject = CountedObject<BiasedRefCounted>;
+    using DeferredObject = CountedObject<DeferredRefCounted>;
+
+    // Holds on to another deferred object, so destroying it releases one more
+    struct DeferredParent : public DeferredObject {
+        DeferredParent(eastl::atomic<i32>* destroyed, SharedRef<DeferredObject> child) : DeferredObject(destroyed), child(eastl::move(child)) {}
+
+        SharedRef<DeferredObject> child;
+    };
+} // namespace
+
+TEST(TestRefCounted, AtomicLifetime) {
+    ExpectSingleThreadedLifetime<RefCounted>();
+}
+
+TEST(TestRefCounted, NonAtomicLifetime) {
+    ExpectSingleThreadedLifetime<LocalRefCounted>();
+}
+
+TEST(TestRefCounted, BiasedLifetime) {
+    ExpectSingleThreadedLifetime<BiasedRefCounted>();
+}
+
+TEST(TestRefCounted, BiasedLastReleaseOnOtherThread) {
+    eastl::atomic<i32> destroyed = { 0 };
+    SharedRef<BiasedObject> owned = SharedRef<BiasedObject>::Create(&destroyed);
+    SharedRef<BiasedObject> shared;
+    // copied on another thread, so counted on the shared count
+    std::thread([&]() { shared = owned; }).join();
+
+    // the owner's count drops to zero and is merged into the shared count
+    owned = nullptr;
+    EXPECT_EQ(destroyed.load(), 0);
+
+    std::thread([&]() { shared = nullptr; }).join();
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, BiasedReleaseQueuedOnOwner) {
+    eastl::atomic<i32> destroyed = { 0 };
+    SharedRef<BiasedObject> owned = SharedRef<BiasedObject>::Create(&destroyed);
+    SharedRef<BiasedObject> shared = owned;
+
+    // drives the shared count negative while the owner still holds a reference
+    std::thread([ref = eastl::move(shared)]() mutable { ref = nullptr; }).join();
+    EXPECT_EQ(destroyed.load(), 0);
+
+    BiasedRefCounted::ProcessMergeQueue();
+    EXPECT_EQ(destroyed.load(), 0);
+    owned = nullptr;
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, BiasedFirstReferenceOnOtherThread) {
+    eastl::atomic<i32> destroyed = { 0 };
+    // created here but only ever referenced on another thread, so the owner never merges it on its own
+    BiasedObject* object = new BiasedObject(&destroyed);
+    std::thread([object]() { SharedRef<BiasedObject> ref(object); }).join();
+    EXPECT_EQ(destroyed.load(), 0);
+
+    // the first reference queued it here
+    BiasedRefCounted::ProcessMergeQueue();
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, BiasedOwnerExitsFirst) {
+    eastl::atomic<i32> destroyed = { 0 };
+    SharedRef<BiasedObject> shared;
+    std::thread([&]() {
+        SharedRef<BiasedObject> owned = SharedRef<BiasedObject>::Create(&destroyed);
+        shared = owned;
+    }).join();
+    EXPECT_EQ(destroyed.load(), 0);
+
+    // the owner's queue is closed, so this thread merges the counts itself
+    shared = nullptr;
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, BiasedConcurrentCopies) {
+    constexpr i32 threadCount = 8;
+    eastl::atomic<i32> destroyed = { 0 };
+    SharedRef<BiasedObject> owned = SharedRef<BiasedObject>::Create(&destroyed);
+
+    eastl::vector<std::thread> threads;
+    for (i32 t = 0; t < threadCount; ++t) {
+        threads.emplace_back([ref = owned]() {
+            for (i32 i = 0; i < 10000; ++i) {
+                SharedRef<BiasedObject> copy = ref;
+            }
+        });
+    }
+    for (i32 i = 0; i < 10000; ++i) {
+        SharedRef<BiasedObject> copy = owned;
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(destroyed.load(), 0);
+
+    owned = nullptr;
+    BiasedRefCounted::ProcessMergeQueue();
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, DeferredDestroyedAtReclaim) {
+    eastl::atomic<i32> destroyed = { 0 };
+    {
+        SharedRef<DeferredObject> object = SharedRef<DeferredObject>::Create(&destroyed);
+        SharedRef<DeferredObject> copy = object;
+    }
+    EXPECT_EQ(destroyed.load(), 0);
+    EXPECT_EQ(DeferredRefCounted::Reclaim(), 1u);
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, DeferredReclaimBudget) {
+    eastl::atomic<i32> destroyed = { 0 };
+    for (i32 i = 0; i < 10; ++i) {
+        SharedRef<DeferredObject> object = SharedRef<DeferredObject>::Create(&destroyed);
+    }
+    EXPECT_EQ(DeferredRefCounted::Reclaim(4), 4u);
+    EXPECT_EQ(destroyed.load(), 4);
+    EXPECT_EQ(DeferredRefCounted::Reclaim(), 6u);
+    EXPECT_EQ(destroyed.load(), 10);
+}
+
+TEST(TestRefCounted, DeferredReclaimFollowsDestructorChains) {
+    eastl::atomic<i32> destroyed = { 0 };
+    {
+        SharedRef<DeferredObject> child = SharedRef<DeferredObject>::Create(&destroyed);
+        SharedRef<DeferredParent> parent = SharedRef<DeferredParent>::Create(&destroyed, eastl::move(child));
+    }
+    EXPECT_EQ(DeferredRefCounted::Reclaim(), 2u);
+    EXPECT_EQ(destroyed.load(), 2);
+}
+
+TEST(TestRefCounted, DeferredReclaimAllAcrossThreads) {
+    eastl::atomic<i32> destroyed = { 0 };
+    SharedRef<DeferredObject> object = SharedRef<DeferredObject>::Create(&destroyed);
+    eastl::atomic<bool> released = { false };
+    eastl::atomic<bool> done = { false };
+    std::thread worker([&]() {
+        object = nullptr;
+        released.store(true);
+        // keep the thread alive so its exit doesn't flush the list
+        while (!done.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!released.load()) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(destroyed.load(), 0);
+    EXPECT_GE(DeferredRefCounted::ReclaimAll(), 1u);
+    EXPECT_EQ(destroyed.load(), 1);
+    done.store(true);
+    worker.join();
+}
+
+TEST(TestRefCounted, DeferredFlushedOnThreadExit) {
+    eastl::atomic<i32> destroyed = { 0 };
+    std::thread([&]() {
+        SharedRef<DeferredObject> object = SharedRef<DeferredObject>::Create(&destroyed);
+    }).join();
+    EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(TestRefCounted, DeferredReclaimThread) {
+    eastl::atomic<i32> destroyed = { 0 };
+    DeferredRefCounted::StartReclaimThread(1);
+    std::thread([&]() {
+        SharedRef<DeferredObject> object = SharedRef<DeferredObject>::Create(&destroyed);
+        object = nullptr;
+        while (destroyed.load() == 0) {
+            std::this_thread::yield();
+        }
+    }).join();
+    DeferredRefCounted::StopReclaimThread();
+    EXPECT_EQ(destroyed.load(), 1);
+}
@@ -0,0 +1,131 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/RefCountedTrailing.hpp>
+
+#include <EASTL/string.h>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace PyroshockStudios;
+
+namespace {
+    struct Tracked {
+        Tracked() { ++live; }
+        Tracked(const Tracked&) { ++live; }
+        ~Tracked() { --live; }
+
+        static inline i32 live = 0;
+    };
+
+    // Throws from the constructor once `throwAfter` instances were built
+    struct ThrowingElement {
+        ThrowingElement() {
+            if (throwAfter-- == 0) {
+                throw std::runtime_error("element");
+            }
+            ++live;
+        }
+        ~ThrowingElement() { --live; }
+
+        static inline i32 throwAfter = -1;
+        static inline i32 live = 0;
+    };
+
+    class ThrowingHeader : public RefCountedTrailing<ThrowingHeader, Tracked> {
+    public:
+        ThrowingHeader() { throw std::runtime_error("header"); }
+    };
+
+    class StringTable : public RefCountedTrailing<StringTable, char> {
+    public:
+        explicit StringTable(u32 stringCount) : stringCount(stringCount) {}
+
+        u32 stringCount;
+    };
+} // namespace
+
+TEST(TestRefCountedArray, SingleAlignedAllocation) {
+    SharedRef<RefCountedArray<u32>> array = RefCountedArray<u32>::Create(100);
+    ASSERT_EQ(array->Size(), 100u);
+    EXPECT_TRUE(PYRO_VERIFY_ALIGNMENT(reinterpret_cast<uptr>(array.Get()), 64));
+    // the elements live right behind the header
+    const u8* header = reinterpret_cast<const u8*>(array.Get());
+    const u8* elements = reinterpret_cast<const u8*>(array->Data());
+    EXPECT_GE(elements, header + sizeof(RefCountedArray<u32>));
+    EXPECT_LT(elements, header + sizeof(RefCountedArray<u32>) + alignof(u32));
+    for (u32 value : *array) {
+        EXPECT_EQ(value, 0u);
+    }
+}
+
+TEST(TestRefCountedArray, CopiesSpan) {
+    const u8 bytes[] = { 1, 2, 3, 4, 5 };
+    SharedRef<RefCountedArray<u8>> blob = RefCountedArray<u8>::Create(eastl::span<const u8>(bytes, 5));
+    SharedRef<RefCountedArray<u8>> shared = blob;
+    ASSERT_EQ(shared->Size(), 5u);
+    EXPECT_EQ(memcmp(shared->Data(), bytes, 5), 0);
+    EXPECT_EQ((*shared)[4], 5);
+}
+
+TEST(TestRefCountedArray, DestroysElements) {
+    {
+        SharedRef<RefCountedArray<Tracked>> array = RefCountedArray<Tracked>::Create(16);
+        EXPECT_EQ(Tracked::live, 16);
+        SharedRef<RefCountedArray<Tracked>> copy = array;
+        array = nullptr;
+        EXPECT_EQ(Tracked::live, 16);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(TestRefCountedArray, EmptyArray) {
+    SharedRef<RefCountedArray<u64>> array = RefCountedArray<u64>::CreateUninitialized(0);
+    EXPECT_EQ(array->Size(), 0u);
+    EXPECT_EQ(array->begin(), array->end());
+}
+
+TEST(TestRefCountedArray, TrailingHeader) {
+    const char text[] = "alpha\0beta";
+    SharedRef<StringTable> table = StringTable::CreateWithTrailing(sizeof(text), 2u);
+    memcpy(table->TrailingData(), text, sizeof(text));
+    EXPECT_EQ(table->stringCount, 2u);
+    EXPECT_EQ(table->TrailingSize(), sizeof(text));
+    EXPECT_STREQ(table->TrailingData() + 6, "beta");
+}
+
+TEST(TestRefCountedArray, ThrowingElementUnwinds) {
+    ThrowingElement::throwAfter = 5;
+    EXPECT_THROW((void)RefCountedArray<ThrowingElement>::Create(16), std::runtime_error);
+    // the five built before the throw were destroyed, the block is freed (checked by LeakSanitizer)
+    EXPECT_EQ(ThrowingElement::live, 0);
+    ThrowingElement::throwAfter = -1;
+}
+
+TEST(TestRefCountedArray, ThrowingHeaderUnwinds) {
+    EXPECT_THROW((void)ThrowingHeader::CreateWithTrailing(16), std::runtime_error);
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(TestRefCountedArray, OverflowingCountThrows) {
+    EXPECT_THROW((void)RefCountedArray<u64>::Create(SIZE_MAX / sizeof(u64)), std::bad_array_new_length);
+}
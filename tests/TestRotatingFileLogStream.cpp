@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Logging/RotatingFileLogStream.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    // Fresh directory per test, removed with everything in it afterwards
+    class TestRotatingFileLogStream : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            mDirectory = std::filesystem::temp_directory_path() / ("pyro_rotating_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::remove_all(mDirectory);
+            std::filesystem::create_directories(mDirectory);
+        }
+        void TearDown() override { std::filesystem::remove_all(mDirectory); }
+
+        RotatingFileLogConfig Config() const {
+            RotatingFileLogConfig config;
+            config.basePath = (mDirectory / "test").string().c_str();
+            return config;
+        }
+
+        static eastl::string ReadFile(const eastl::string& path) {
+            FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+            eastl::string content(file.Length(), '\0');
+            EXPECT_EQ(file.Read(content.data(), content.size()), content.size());
+            return content;
+        }
+
+        static usize CountLines(const eastl::string& text) {
+            return static_cast<usize>(eastl::count(text.begin(), text.end(), '\n'));
+        }
+
+        usize FilesOnDisk() const {
+            return static_cast<usize>(eastl::distance(std::filesystem::directory_iterator(mDirectory), std::filesystem::directory_iterator()));
+        }
+
+        std::filesystem::path mDirectory;
+    };
+} // namespace
+
+TEST_F(TestRotatingFileLogStream, WritesTimestampedLines) {
+    RotatingFileLogStream stream(Config());
+    stream.Log(LogSeverity::Info, "hello");
+    stream.Log(LogSeverity::Warn, "world", 5);
+    stream.Flush();
+    ASSERT_TRUE(stream.IsGood());
+
+    const auto segments = stream.Segments();
+    ASSERT_EQ(segments.size(), 1u);
+    const eastl::string content = ReadFile(segments[0]);
+    // "YYYY-MM-DD HH:MM:SS.mmm [Info] hello\n"
+    ASSERT_EQ(CountLines(content), 2u);
+    EXPECT_EQ(content[4], '-');
+    EXPECT_EQ(content[19], '.');
+    EXPECT_NE(content.find(" [Info] hello\n"), eastl::string::npos);
+    EXPECT_NE(content.find(" [Warn] world\n"), eastl::string::npos);
+    // the preallocated space doesn't show up in the length
+    FileStream file(segments[0], FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+    EXPECT_EQ(file.Length(), content.size());
+}
+
+TEST_F(TestRotatingFileLogStream, DropsBelowMinSeverity) {
+    RotatingFileLogConfig config = Config();
+    config.minSeverity = LogSeverity::Warn;
+    RotatingFileLogStream stream(config);
+    stream.Log(LogSeverity::Info, "dropped");
+    stream.Log(LogSeverity::Error, "kept");
+    stream.Flush();
+    EXPECT_EQ(CountLines(ReadFile(stream.Segments()[0])), 1u);
+}
+
+TEST_F(TestRotatingFileLogStream, RotatesBySize) {
+    RotatingFileLogConfig config = Config();
+    config.blockSize = 4096;
+    config.maxSegmentSize = 8192;
+    eastl::vector<eastl::string> segments;
+    {
+        RotatingFileLogStream stream(config);
+        const eastl::string padding(80, 'x');
+        for (u32 i = 0; i < 400; ++i) {
+            stream.Log(LogSeverity::Info, (eastl::to_string(i) + " " + padding).c_str());
+        }
+        stream.Flush();
+        segments = stream.Segments();
+        EXPECT_EQ(stream.DroppedCount(), 0u);
+    }
+    ASSERT_GE(segments.size(), 4u);
+    usize lines = 0;
+    for (const eastl::string& segment : segments) {
+        const eastl::string content = ReadFile(segment);
+        EXPECT_LE(content.size(), config.maxSegmentSize);
+        // rotation happens between whole lines
+        ASSERT_FALSE(content.empty());
+        EXPECT_EQ(content.back(), '\n');
+        lines += CountLines(content);
+    }
+    EXPECT_EQ(lines, 400u);
+    EXPECT_NE(ReadFile(segments.front()).find("[Info] 0 x"), eastl::string::npos);
+    EXPECT_NE(ReadFile(segments.back()).find("[Info] 399 x"), eastl::string::npos);
+}
+
+TEST_F(TestRotatingFileLogStream, DeletesOldestSegments) {
+    RotatingFileLogConfig config = Config();
+    config.blockSize = 4096;
+    config.maxSegmentSize = 4096;
+    config.maxSegments = 2;
+    {
+        RotatingFileLogStream stream(config);
+        const eastl::string line(200, 'y');
+        for (u32 i = 0; i < 200; ++i) {
+            stream.Log(LogSeverity::Info, line.c_str());
+        }
+        stream.Flush();
+        EXPECT_EQ(stream.Segments().size(), 2u);
+    }
+    EXPECT_EQ(FilesOnDisk(), 2u);
+}
+
+TEST_F(TestRotatingFileLogStream, RotatesByAge) {
+    RotatingFileLogConfig config = Config();
+    config.maxSegmentSeconds = 1;
+    RotatingFileLogStream stream(config);
+    stream.Log(LogSeverity::Info, "first");
+    stream.Flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    stream.Log(LogSeverity::Info, "second");
+    stream.Flush();
+    const auto segments = stream.Segments();
+    ASSERT_EQ(segments.size(), 2u);
+    EXPECT_NE(ReadFile(segments[1]).find("second"), eastl::string::npos);
+}
+
+TEST_F(TestRotatingFileLogStream, WritesErrorsWithoutFlush) {
+    RotatingFileLogConfig config = Config();
+    config.flushIntervalMs = 60'000;
+    RotatingFileLogStream stream(config);
+    stream.Log(LogSeverity::Error, "urgent");
+    const eastl::string segment = stream.Segments()[0];
+    for (u32 i = 0; i < 500 && ReadFile(segment).empty(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_NE(ReadFile(segment).find("urgent"), eastl::string::npos);
+}
+
+TEST_F(TestRotatingFileLogStream, ConcurrentProducers) {
+    RotatingFileLogConfig config = Config();
+    config.blockSize = 4096;
+    config.maxSegmentSize = 64 * 1024;
+    config.maxSegments = 0;
+    config.maxPendingBlocks = 1024;
+    eastl::vector<eastl::string> segments;
+    {
+        RotatingFileLogStream stream(config);
+        eastl::vector<std::thread> threads;
+        for (u32 t = 0; t < 4; ++t) {
+            threads.emplace_back([&stream] {
+                for (u32 i = 0; i < 2000; ++i) {
+                    stream.Log(LogSeverity::Info, "concurrent message");
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        stream.Flush();
+        segments = stream.Segments();
+        EXPECT_EQ(stream.DroppedCount(), 0u);
+    }
+    usize lines = 0;
+    for (const eastl::string& segment : segments) {
+        lines += CountLines(ReadFile(segment));
+    }
+    EXPECT_EQ(lines, 8000u);
+}
+
+TEST_F(TestRotatingFileLogStream, ReopensAfterOpenFailure) {
+    const std::filesystem::path missing = mDirectory / "missing";
+    RotatingFileLogConfig config = Config();
+    config.basePath = (missing / "test").string().c_str();
+    config.reopenIntervalMs = 0;
+    RotatingFileLogStream stream(config);
+    EXPECT_FALSE(stream.IsGood());
+
+    stream.Log(LogSeverity::Info, "lost one");
+    // spans two lines, still one message
+    stream.Log(LogSeverity::Info, "lost\ntwo");
+    stream.Flush();
+    EXPECT_EQ(stream.DroppedCount(), 2u);
+    EXPECT_TRUE(stream.Segments().empty());
+
+    std::filesystem::create_directories(missing);
+    stream.Log(LogSeverity::Info, "kept");
+    stream.Flush();
+    EXPECT_EQ(stream.DroppedCount(), 2u);
+
+    const auto segments = stream.Segments();
+    ASSERT_EQ(segments.size(), 1u);
+    const eastl::string content = ReadFile(segments[0]);
+    EXPECT_EQ(CountLines(content), 1u);
+    EXPECT_NE(content.find("kept"), eastl::string::npos);
+}
@@ -0,0 +1,138 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/SlabAllocator.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+TEST(TestSlabAllocator, BlocksAreReused) {
+    void* first = SlabAllocator::Allocate(40);
+    ASSERT_TRUE(SlabAllocator::Owns(first));
+    SlabAllocator::Deallocate(first);
+    void* second = SlabAllocator::Allocate(40);
+    EXPECT_EQ(first, second);
+    SlabAllocator::Deallocate(second);
+}
+
+TEST(TestSlabAllocator, EverySizeIsUsable) {
+    eastl::vector<u8*> blocks;
+    for (usize size = 1; size <= SlabAllocator::MAX_BLOCK_SIZE; size += 7) {
+        u8* block = static_cast<u8*>(SlabAllocator::Allocate(size));
+        ASSERT_NE(block, nullptr);
+        EXPECT_TRUE(SlabAllocator::Owns(block));
+        EXPECT_EQ(reinterpret_cast<uptr>(block) % SlabAllocator::MIN_ALIGNMENT, 0u);
+        memset(block, static_cast<int>(size), size);
+        blocks.push_back(block);
+    }
+    for (usize i = 0; i < blocks.size(); ++i) {
+        usize size = 1 + i * 7;
+        EXPECT_EQ(blocks[i][0], static_cast<u8>(size));
+        EXPECT_EQ(blocks[i][size - 1], static_cast<u8>(size));
+        SlabAllocator::Deallocate(blocks[i]);
+    }
+}
+
+TEST(TestSlabAllocator, AlignmentAndOffset) {
+    for (usize alignment : { 32u, 64u, 256u, 1024u, 4096u }) {
+        void* aligned = SlabAllocator::Allocate(24, alignment);
+        EXPECT_EQ(reinterpret_cast<uptr>(aligned) % alignment, 0u);
+        SlabAllocator::Deallocate(aligned);
+
+        void* offset = SlabAllocator::Allocate(24, alignment, 8);
+        EXPECT_EQ((reinterpret_cast<uptr>(offset) + 8) % alignment, 0u);
+        SlabAllocator::Deallocate(offset);
+    }
+}
+
+TEST(TestSlabAllocator, LargeSizesFallBackToHeap) {
+    void* block = SlabAllocator::Allocate(SlabAllocator::MAX_BLOCK_SIZE + 1);
+    ASSERT_NE(block, nullptr);
+    EXPECT_FALSE(SlabAllocator::Owns(block));
+    memset(block, 0xAB, SlabAllocator::MAX_BLOCK_SIZE + 1);
+    SlabAllocator::Deallocate(block);
+    EXPECT_FALSE(SlabAllocator::Owns(nullptr));
+}
+
+TEST(TestSlabAllocator, EASTLContainers) {
+    eastl::vector<u32, SlabAllocator> values;
+    eastl::vector<char, SlabAllocator> text;
+    for (u32 i = 0; i < 4096; ++i) {
+        values.push_back(i);
+        text.push_back(static_cast<char>('a' + i % 26));
+    }
+    EXPECT_EQ(values[4095], 4095u);
+    EXPECT_EQ(text[27], 'b');
+}
+
+TEST(TestSlabAllocator, CrossThreadDeallocation) {
+    constexpr usize count = 10000;
+    eastl::vector<void*> blocks;
+    std::thread producer([&]() {
+        for (usize i = 0; i < count; ++i) {
+            blocks.push_back(SlabAllocator::Allocate(16 + i % 500));
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&]() {
+        for (void* block : blocks) {
+            SlabAllocator::Deallocate(block);
+        }
+    });
+    consumer.join();
+
+    // the consumer's magazines went back to the depot when it exited
+    void* block = SlabAllocator::Allocate(16);
+    EXPECT_TRUE(SlabAllocator::Owns(block));
+    SlabAllocator::Deallocate(block);
+}
+
+TEST(TestSlabAllocator, ConcurrentChurn) {
+    constexpr usize threadCount = 8;
+    eastl::vector<std::thread> threads;
+    for (usize t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t]() {
+            eastl::vector<u64*> live;
+            for (usize i = 0; i < 20000; ++i) {
+                u64* block = static_cast<u64*>(SlabAllocator::Allocate(8 + (i * 13 + t) % 600));
+                *block = i;
+                live.push_back(block);
+                if (live.size() > 256) {
+                    for (usize j = 0; j < 128; ++j) {
+                        SlabAllocator::Deallocate(live[j]);
+                    }
+                    live.erase(live.begin(), live.begin() + 128);
+                }
+            }
+            for (u64* block : live) {
+                SlabAllocator::Deallocate(block);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
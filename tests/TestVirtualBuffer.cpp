@@ -0,0 +1,104 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Stream/MemoryStream.hpp>
+#include <PyroCommon/VirtualBuffer.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace PyroshockStudios;
+
+TEST(TestVirtualBuffer, GrowsWithoutMoving) {
+    VirtualBuffer buffer(64 * 1024 * 1024);
+    ASSERT_TRUE(buffer.Resize(16));
+    u8* data = buffer.Data();
+    ASSERT_NE(data, nullptr);
+    data[0] = 0x5A;
+
+    ASSERT_TRUE(buffer.Resize(10 * 1024 * 1024));
+    EXPECT_EQ(buffer.Data(), data);
+    EXPECT_EQ(buffer.Data()[0], 0x5A);
+    EXPECT_GE(buffer.CommittedBytes(), buffer.Size());
+    buffer.Data()[buffer.Size() - 1] = 0xA5;
+}
+
+TEST(TestVirtualBuffer, RefusesToGrowPastReservation) {
+    VirtualBuffer buffer(1024 * 1024);
+    EXPECT_TRUE(buffer.Resize(buffer.MaxSize()));
+    EXPECT_FALSE(buffer.Resize(buffer.MaxSize() + 1));
+
+    VirtualBuffer empty;
+    EXPECT_TRUE(empty.Resize(0));
+    EXPECT_FALSE(empty.Resize(1));
+}
+
+TEST(TestVirtualBuffer, RegrownBytesAreZeroed) {
+    VirtualBuffer buffer(1024 * 1024);
+    ASSERT_TRUE(buffer.Resize(256));
+    memset(buffer.Data(), 0xFF, 256);
+    ASSERT_TRUE(buffer.Resize(8));
+    ASSERT_TRUE(buffer.Resize(256));
+    EXPECT_EQ(buffer.Data()[7], 0xFF);
+    for (usize i = 8; i < 256; ++i) {
+        ASSERT_EQ(buffer.Data()[i], 0);
+    }
+
+    buffer.Clear();
+    buffer.ShrinkToFit();
+    EXPECT_EQ(buffer.CommittedBytes(), 0u);
+    ASSERT_TRUE(buffer.Resize(256));
+    EXPECT_EQ(buffer.Data()[0], 0);
+}
+
+TEST(TestVirtualBuffer, Insert) {
+    VirtualBuffer buffer(1024 * 1024);
+    ASSERT_TRUE(buffer.Insert(0, "world", 5));
+    ASSERT_TRUE(buffer.Insert(0, "hello ", 6));
+    EXPECT_FALSE(buffer.Insert(100, "!", 1));
+    EXPECT_EQ(memcmp(buffer.Data(), "hello world", 11), 0);
+}
+
+TEST(TestVirtualBuffer, BacksMemoryStream) {
+    VirtualBuffer buffer(64 * 1024 * 1024);
+    const u8* base = buffer.Data();
+    ASSERT_NE(base, nullptr);
+    MemoryStream stream(eastl::move(buffer));
+    for (u32 i = 0; i < 256 * 1024; ++i) {
+        ASSERT_EQ(stream.Write(&i, sizeof(i)), sizeof(i));
+    }
+    // the span comes from the reservation, growing never moved it
+    const auto span = stream.Span();
+    ASSERT_NE(span.data(), nullptr);
+    EXPECT_EQ(span.data(), base);
+    ASSERT_EQ(span.size(), 256u * 1024 * sizeof(u32));
+    for (u32 i = 0; i < 256 * 1024; i += 1021) {
+        u32 stored = 0;
+        memcpy(&stored, span.data() + i * sizeof(u32), sizeof(stored));
+        ASSERT_EQ(stored, i);
+    }
+    EXPECT_EQ(stream.Length(), 256u * 1024 * sizeof(u32));
+
+    ASSERT_TRUE(stream.Seek(4 * sizeof(u32), StreamOrigin::Start));
+    u32 value = 0;
+    ASSERT_EQ(stream.Read(&value, sizeof(value)), sizeof(value));
+    EXPECT_EQ(value, 4u);
+}
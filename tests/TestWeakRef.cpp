@@ -0,0 +1,117 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <PyroCommon/Memory.hpp>
+
+#include <EASTL/vector.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace PyroshockStudios;
+
+namespace {
+    struct Observed : public WeakRefCounted {
+        explicit Observed(i32 value, i32* destroyed = nullptr) : value(value), destroyed(destroyed) {}
+        ~Observed() override {
+            if (destroyed) {
+                ++*destroyed;
+            }
+        }
+
+        i32 value;
+        i32* destroyed;
+    };
+
+    struct DerivedObserved : public Observed {
+        using Observed::Observed;
+    };
+} // namespace
+
+TEST(TestWeakRef, LockWhileAlive) {
+    SharedRef<Observed> strong = SharedRef<Observed>::Create(5);
+    WeakRef<Observed> weak = strong;
+    EXPECT_FALSE(weak.Expired());
+
+    SharedRef<Observed> locked = weak.Lock();
+    ASSERT_TRUE(locked);
+    EXPECT_EQ(locked.Get(), strong.Get());
+    EXPECT_EQ(locked->value, 5);
+}
+
+TEST(TestWeakRef, ExpiresWithLastStrongRef) {
+    i32 destroyed = 0;
+    SharedRef<Observed> strong = SharedRef<Observed>::Create(1, &destroyed);
+    WeakRef<Observed> weak = strong;
+    WeakRef<Observed> copy = weak;
+
+    strong = nullptr;
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_TRUE(weak.Expired());
+    EXPECT_FALSE(weak.Lock());
+    EXPECT_FALSE(copy.Lock());
+}
+
+TEST(TestWeakRef, EmptyAndReset) {
+    WeakRef<Observed> empty;
+    EXPECT_TRUE(empty.Expired());
+    EXPECT_FALSE(empty.Lock());
+
+    SharedRef<Observed> strong = SharedRef<Observed>::Create(2);
+    WeakRef<Observed> weak = strong;
+    weak.Reset();
+    EXPECT_TRUE(weak.Expired());
+    EXPECT_TRUE(strong);
+}
+
+TEST(TestWeakRef, ConvertsToBase) {
+    SharedRef<DerivedObserved> strong = SharedRef<DerivedObserved>::Create(3);
+    WeakRef<DerivedObserved> derived = strong;
+    WeakRef<Observed> base = derived;
+    SharedRef<Observed> locked = base.Lock();
+    ASSERT_TRUE(locked);
+    EXPECT_EQ(locked->value, 3);
+}
+
+TEST(TestWeakRef, ConcurrentLockAndRelease) {
+    for (i32 round = 0; round < 100; ++round) {
+        i32 destroyed = 0;
+        SharedRef<Observed> strong = SharedRef<Observed>::Create(round, &destroyed);
+        WeakRef<Observed> weak = strong;
+
+        eastl::vector<std::thread> threads;
+        for (i32 t = 0; t < 4; ++t) {
+            threads.emplace_back([weak]() {
+                for (i32 i = 0; i < 1000; ++i) {
+                    if (SharedRef<Observed> locked = weak.Lock()) {
+                        EXPECT_GE(locked->value, 0);
+                    }
+                }
+            });
+        }
+        strong = nullptr;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(destroyed, 1);
+        EXPECT_TRUE(weak.Expired());
+    }
+}
@@ -0,0 +1,89 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Prints the last records of a flight recorder file, e.g. the one left behind by a crashed process.
+//   PyroFlightRecorderDump [-last=<count>] [-severity=Warn] <file>
+
+#include <PyroCommon/CommandLineParser.hpp>
+#include <PyroCommon/Logging/FlightRecorderReader.hpp>
+#include <PyroCommon/Logging/LogChannel.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <stdio.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    constexpr const char* SEVERITY_NAMES[] = { "Verbose", "Debug", "Trace", "Info", "Warn", "Error", "Fatal" };
+
+    void PrintUsage() {
+        fprintf(stderr, "usage: PyroFlightRecorderDump [-last=<count>] [-severity=<Verbose..Fatal>] <file>\n");
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // the input is the last argument that isn't an option
+    const char* path = nullptr;
+    for (i32 i = 1; i < argc; ++i) {
+        if (argv[i][0] != '-') {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        PrintUsage();
+        return 1;
+    }
+
+    CommandLineParser options(argc, argv);
+    LogSeverity minSeverity = LogSeverity::Verbose;
+    if (options.HasOption("severity")) {
+        bool enabled = true;
+        eastl::string severity = options.GetOption("severity");
+        if (!LogChannelRegistry::ParseSeverity(eastl::string_view(severity.data(), severity.size()), minSeverity, enabled) || !enabled) {
+            fprintf(stderr, "unknown severity '%s'\n", severity.c_str());
+            return 1;
+        }
+    }
+    const i64 last = options.GetIntOption("last", 0);
+
+    FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+    FlightRecorderReader reader(file);
+    if (!reader.IsValid()) {
+        fprintf(stderr, "'%s' is not a flight recorder file\n", path);
+        return 1;
+    }
+
+    eastl::span<const FlightRecord> records = last > 0 ? reader.LastRecords(static_cast<usize>(last)) : reader.Records();
+    if (!records.empty() && records.front().sequence != 0) {
+        printf("... %llu earlier messages were overwritten\n", static_cast<unsigned long long>(records.front().sequence));
+    }
+    for (const FlightRecord& record : records) {
+        if (record.severity < minSeverity) {
+            continue;
+        }
+        const u64 offset = record.timestamp - reader.StartTime();
+        printf("[+%llu.%06llus] [T%u] [%s] %s\n", static_cast<unsigned long long>(offset / 1000000000ull),
+            static_cast<unsigned long long>(offset % 1000000000ull / 1000ull), record.thread,
+            SEVERITY_NAMES[static_cast<u32>(record.severity)], record.message.c_str());
+    }
+    return 0;
+}
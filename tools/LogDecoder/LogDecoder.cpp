@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2025 Pyroshock Studios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Turns a binary log written by BinaryLogStream back into text.
+//   PyroLogDecoder [-severity=Warn] [-since=<ms>] [-until=<ms>] [-sites] <file>
+// -since/-until are milliseconds from the start of the log, -sites appends the file and line of each message.
+
+#include <PyroCommon/CommandLineParser.hpp>
+#include <PyroCommon/Logging/BinaryLogReader.hpp>
+#include <PyroCommon/Logging/LogChannel.hpp>
+#include <PyroCommon/Stream/FileStream.hpp>
+
+#include <stdio.h>
+
+using namespace PyroshockStudios;
+
+namespace {
+    constexpr const char* SEVERITY_NAMES[] = { "Verbose", "Debug", "Trace", "Info", "Warn", "Error", "Fatal" };
+
+    void PrintUsage() {
+        fprintf(stderr, "usage: PyroLogDecoder [-severity=<Verbose..Fatal>] [-since=<ms>] [-until=<ms>] [-sites] <file>\n");
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // the input is the last argument that isn't an option
+    const char* path = nullptr;
+    for (i32 i = 1; i < argc; ++i) {
+        if (argv[i][0] != '-') {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        PrintUsage();
+        return 1;
+    }
+
+    CommandLineParser options(argc, argv);
+    LogSeverity minSeverity = LogSeverity::Verbose;
+    if (options.HasOption("severity")) {
+        bool enabled = true;
+        eastl::string severity = options.GetOption("severity");
+        if (!LogChannelRegistry::ParseSeverity(eastl::string_view(severity.data(), severity.size()), minSeverity, enabled) || !enabled) {
+            fprintf(stderr, "unknown severity '%s'\n", severity.c_str());
+            return 1;
+        }
+    }
+    const u64 since = static_cast<u64>(options.GetIntOption("since", 0)) * 1000000ull;
+    const u64 until = options.HasOption("until") ? static_cast<u64>(options.GetIntOption("until", 0)) * 1000000ull : ~0ull;
+    const bool printSites = options.HasOption("sites");
+
+    FileStream file(path, FileStream::Encoding::Binary, FileStream::Mode::ReadOnly);
+    BinaryLogReader reader(file);
+    if (!reader.IsValid()) {
+        fprintf(stderr, "'%s' is not a binary log\n", path);
+        return 1;
+    }
+
+    BinaryLogRecord record;
+    while (reader.Next(record)) {
+        const u64 offset = record.timestamp - reader.StartTime();
+        if (offset < since) {
+            continue;
+        }
+        if (offset > until) {
+            break;
+        }
+        if (record.severity < minSeverity) {
+            continue;
+        }
+        printf("[+%llu.%06llus] [%s] %s", static_cast<unsigned long long>(offset / 1000000000ull),
+            static_cast<unsigned long long>(offset % 1000000000ull / 1000ull), SEVERITY_NAMES[static_cast<u32>(record.severity)],
+            record.message.c_str());
+        if (printSites && record.site) {
+            printf("  (%s:%u)", record.site->file.c_str(), record.site->line);
+        }
+        printf("\n");
+    }
+    return 0;
+}